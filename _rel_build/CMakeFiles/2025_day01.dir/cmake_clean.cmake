@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/2025_day01.dir/days/2025_day01.c.o"
+  "CMakeFiles/2025_day01.dir/days/2025_day01.c.o.d"
+  "bin/2025_day01"
+  "bin/2025_day01.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/2025_day01.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/2025_day03.dir/days/2025_day03.c.o"
+  "CMakeFiles/2025_day03.dir/days/2025_day03.c.o.d"
+  "bin/2025_day03"
+  "bin/2025_day03.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/2025_day03.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/2025_day04.dir/days/2025_day04.c.o"
+  "CMakeFiles/2025_day04.dir/days/2025_day04.c.o.d"
+  "bin/2025_day04"
+  "bin/2025_day04.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/2025_day04.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
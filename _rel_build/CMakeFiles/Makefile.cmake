@@ -0,0 +1,215 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "CMakeFiles/VerifyGlobs.cmake"
+  "CMakeFiles/cmake.verify_globs"
+  "/usr/share/cmake-3.25/Modules/CMakeCCompiler.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCCompilerABI.c"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCompilerIdDetection.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompileFeatures.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompilerABI.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompilerId.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindBinUtils.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitIncludeInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitLinkInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseLibraryArchitecture.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystem.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeTestCCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeTestCompilerCommon.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeUnixFindMake.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ADSP-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ARMCC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ARMClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/AppleClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Borland-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Bruce-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Clang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Clang-DetermineCompilerInternal.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Compaq-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Cray-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Embarcadero-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Fujitsu-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/FujitsuClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GHS-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-FindBinUtils.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/HP-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IAR-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMCPP-C-DetermineVersionInternal.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMClang-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Intel-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IntelLLVM-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/LCC-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/MSVC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/NVHPC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/NVIDIA-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/OpenWatcom-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/PGI-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/PathScale-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SCO-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SDCC-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SunPro-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/TI-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Tasking-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/TinyCC-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/VisualAge-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Watcom-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XL-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XLClang-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/zOS-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/FindCURL.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/FeatureTesting.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/SelectLibraryConfigurations.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "DartConfiguration.tcl"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/containers.dir/DependInfo.cmake"
+  "CMakeFiles/aoc_net.dir/DependInfo.cmake"
+  "CMakeFiles/core.dir/DependInfo.cmake"
+  "CMakeFiles/aoc_prefetch.dir/DependInfo.cmake"
+  "CMakeFiles/aoc_submit.dir/DependInfo.cmake"
+  "CMakeFiles/2024_day01.dir/DependInfo.cmake"
+  "CMakeFiles/run-2024_day01-part1.dir/DependInfo.cmake"
+  "CMakeFiles/run-2024_day01-part2.dir/DependInfo.cmake"
+  "CMakeFiles/submit-2024_day01-part1.dir/DependInfo.cmake"
+  "CMakeFiles/submit-2024_day01-part2.dir/DependInfo.cmake"
+  "CMakeFiles/bench-2024_day01.dir/DependInfo.cmake"
+  "CMakeFiles/2025_day01.dir/DependInfo.cmake"
+  "CMakeFiles/run-2025_day01-part1.dir/DependInfo.cmake"
+  "CMakeFiles/run-2025_day01-part2.dir/DependInfo.cmake"
+  "CMakeFiles/submit-2025_day01-part1.dir/DependInfo.cmake"
+  "CMakeFiles/submit-2025_day01-part2.dir/DependInfo.cmake"
+  "CMakeFiles/bench-2025_day01.dir/DependInfo.cmake"
+  "CMakeFiles/2025_day02.dir/DependInfo.cmake"
+  "CMakeFiles/run-2025_day02-part1.dir/DependInfo.cmake"
+  "CMakeFiles/run-2025_day02-part2.dir/DependInfo.cmake"
+  "CMakeFiles/submit-2025_day02-part1.dir/DependInfo.cmake"
+  "CMakeFiles/submit-2025_day02-part2.dir/DependInfo.cmake"
+  "CMakeFiles/bench-2025_day02.dir/DependInfo.cmake"
+  "CMakeFiles/2025_day03.dir/DependInfo.cmake"
+  "CMakeFiles/run-2025_day03-part1.dir/DependInfo.cmake"
+  "CMakeFiles/run-2025_day03-part2.dir/DependInfo.cmake"
+  "CMakeFiles/submit-2025_day03-part1.dir/DependInfo.cmake"
+  "CMakeFiles/submit-2025_day03-part2.dir/DependInfo.cmake"
+  "CMakeFiles/bench-2025_day03.dir/DependInfo.cmake"
+  "CMakeFiles/2025_day04.dir/DependInfo.cmake"
+  "CMakeFiles/run-2025_day04-part1.dir/DependInfo.cmake"
+  "CMakeFiles/run-2025_day04-part2.dir/DependInfo.cmake"
+  "CMakeFiles/submit-2025_day04-part1.dir/DependInfo.cmake"
+  "CMakeFiles/submit-2025_day04-part2.dir/DependInfo.cmake"
+  "CMakeFiles/bench-2025_day04.dir/DependInfo.cmake"
+  "CMakeFiles/2025_day05.dir/DependInfo.cmake"
+  "CMakeFiles/run-2025_day05-part1.dir/DependInfo.cmake"
+  "CMakeFiles/run-2025_day05-part2.dir/DependInfo.cmake"
+  "CMakeFiles/submit-2025_day05-part1.dir/DependInfo.cmake"
+  "CMakeFiles/submit-2025_day05-part2.dir/DependInfo.cmake"
+  "CMakeFiles/bench-2025_day05.dir/DependInfo.cmake"
+  "CMakeFiles/2025_day06.dir/DependInfo.cmake"
+  "CMakeFiles/run-2025_day06-part1.dir/DependInfo.cmake"
+  "CMakeFiles/run-2025_day06-part2.dir/DependInfo.cmake"
+  "CMakeFiles/submit-2025_day06-part1.dir/DependInfo.cmake"
+  "CMakeFiles/submit-2025_day06-part2.dir/DependInfo.cmake"
+  "CMakeFiles/bench-2025_day06.dir/DependInfo.cmake"
+  "CMakeFiles/2025_day07.dir/DependInfo.cmake"
+  "CMakeFiles/run-2025_day07-part1.dir/DependInfo.cmake"
+  "CMakeFiles/run-2025_day07-part2.dir/DependInfo.cmake"
+  "CMakeFiles/submit-2025_day07-part1.dir/DependInfo.cmake"
+  "CMakeFiles/submit-2025_day07-part2.dir/DependInfo.cmake"
+  "CMakeFiles/bench-2025_day07.dir/DependInfo.cmake"
+  "CMakeFiles/2025_day08.dir/DependInfo.cmake"
+  "CMakeFiles/run-2025_day08-part1.dir/DependInfo.cmake"
+  "CMakeFiles/run-2025_day08-part2.dir/DependInfo.cmake"
+  "CMakeFiles/submit-2025_day08-part1.dir/DependInfo.cmake"
+  "CMakeFiles/submit-2025_day08-part2.dir/DependInfo.cmake"
+  "CMakeFiles/bench-2025_day08.dir/DependInfo.cmake"
+  "CMakeFiles/bench-all.dir/DependInfo.cmake"
+  "CMakeFiles/grid_layout_bench.dir/DependInfo.cmake"
+  "CMakeFiles/bench-grid-layout.dir/DependInfo.cmake"
+  "CMakeFiles/containers_test.dir/DependInfo.cmake"
+  "CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/thread_pool_test.dir/DependInfo.cmake"
+  "CMakeFiles/mock_aoc_server.dir/DependInfo.cmake"
+  "CMakeFiles/mock_aoc_server_bin.dir/DependInfo.cmake"
+  "CMakeFiles/aoc_client_test.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,47 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by CMake Version 3.25
+cmake_policy(SET CMP0009 NEW)
+
+# DAY_SOURCES at CMakeLists.txt:84 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true "/root/repo/days/*_day*.c")
+set(OLD_GLOB
+  "/root/repo/days/2024_day01.c"
+  "/root/repo/days/2025_day01.c"
+  "/root/repo/days/2025_day02.c"
+  "/root/repo/days/2025_day03.c"
+  "/root/repo/days/2025_day04.c"
+  "/root/repo/days/2025_day05.c"
+  "/root/repo/days/2025_day06.c"
+  "/root/repo/days/2025_day07.c"
+  "/root/repo/days/2025_day08.c"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_rel_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# CONTAINER_SRCS at CMakeLists.txt:36 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true "/root/repo/src/containers/*.c")
+set(OLD_GLOB
+  "/root/repo/src/containers/bitgrid.c"
+  "/root/repo/src/containers/bitset.c"
+  "/root/repo/src/containers/dsu.c"
+  "/root/repo/src/containers/grid.c"
+  "/root/repo/src/containers/grid_bfs.c"
+  "/root/repo/src/containers/hashmap.c"
+  "/root/repo/src/containers/intern.c"
+  "/root/repo/src/containers/intervalset.c"
+  "/root/repo/src/containers/numset.c"
+  "/root/repo/src/containers/padgrid.c"
+  "/root/repo/src/containers/podmap.c"
+  "/root/repo/src/containers/queue.c"
+  "/root/repo/src/containers/roaring.c"
+  "/root/repo/src/containers/set.c"
+  "/root/repo/src/containers/stack.c"
+  "/root/repo/src/containers/stringbuilder.c"
+  "/root/repo/src/containers/vector.c"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_rel_build/CMakeFiles/cmake.verify_globs")
+endif()
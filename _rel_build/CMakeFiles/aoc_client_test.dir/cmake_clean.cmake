@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/aoc_client_test.dir/src/tests/aoc_client_test.c.o"
+  "CMakeFiles/aoc_client_test.dir/src/tests/aoc_client_test.c.o.d"
+  "bin/aoc_client_test"
+  "bin/aoc_client_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/aoc_client_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/aoc_cache.c" "CMakeFiles/aoc_net.dir/src/aoc_cache.c.o" "gcc" "CMakeFiles/aoc_net.dir/src/aoc_cache.c.o.d"
+  "/root/repo/src/aoc_client.c" "CMakeFiles/aoc_net.dir/src/aoc_client.c.o" "gcc" "CMakeFiles/aoc_net.dir/src/aoc_client.c.o.d"
+  "/root/repo/src/aoc_submit_queue.c" "CMakeFiles/aoc_net.dir/src/aoc_submit_queue.c.o" "gcc" "CMakeFiles/aoc_net.dir/src/aoc_submit_queue.c.o.d"
+  "/root/repo/src/util.c" "CMakeFiles/aoc_net.dir/src/util.c.o" "gcc" "CMakeFiles/aoc_net.dir/src/util.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
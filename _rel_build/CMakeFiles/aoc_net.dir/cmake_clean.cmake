@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/aoc_net.dir/src/aoc_cache.c.o"
+  "CMakeFiles/aoc_net.dir/src/aoc_cache.c.o.d"
+  "CMakeFiles/aoc_net.dir/src/aoc_client.c.o"
+  "CMakeFiles/aoc_net.dir/src/aoc_client.c.o.d"
+  "CMakeFiles/aoc_net.dir/src/aoc_submit_queue.c.o"
+  "CMakeFiles/aoc_net.dir/src/aoc_submit_queue.c.o.d"
+  "CMakeFiles/aoc_net.dir/src/util.c.o"
+  "CMakeFiles/aoc_net.dir/src/util.c.o.d"
+  "lib/libaoc_net.pdb"
+  "lib/libaoc_net.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/aoc_net.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/aoc_prefetch.dir/src/prefetch.c.o"
+  "CMakeFiles/aoc_prefetch.dir/src/prefetch.c.o.d"
+  "bin/aoc_prefetch"
+  "bin/aoc_prefetch.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/aoc_prefetch.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/aoc_submit.dir/src/submit.c.o"
+  "CMakeFiles/aoc_submit.dir/src/submit.c.o.d"
+  "bin/aoc_submit"
+  "bin/aoc_submit.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/aoc_submit.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
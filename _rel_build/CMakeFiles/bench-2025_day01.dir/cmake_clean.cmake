@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench-2025_day01"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/bench-2025_day01.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
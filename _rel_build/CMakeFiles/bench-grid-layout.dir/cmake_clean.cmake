@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench-grid-layout"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/bench-grid-layout.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,35 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/containers/bitgrid.c" "CMakeFiles/containers.dir/src/containers/bitgrid.c.o" "gcc" "CMakeFiles/containers.dir/src/containers/bitgrid.c.o.d"
+  "/root/repo/src/containers/bitset.c" "CMakeFiles/containers.dir/src/containers/bitset.c.o" "gcc" "CMakeFiles/containers.dir/src/containers/bitset.c.o.d"
+  "/root/repo/src/containers/dsu.c" "CMakeFiles/containers.dir/src/containers/dsu.c.o" "gcc" "CMakeFiles/containers.dir/src/containers/dsu.c.o.d"
+  "/root/repo/src/containers/grid.c" "CMakeFiles/containers.dir/src/containers/grid.c.o" "gcc" "CMakeFiles/containers.dir/src/containers/grid.c.o.d"
+  "/root/repo/src/containers/grid_bfs.c" "CMakeFiles/containers.dir/src/containers/grid_bfs.c.o" "gcc" "CMakeFiles/containers.dir/src/containers/grid_bfs.c.o.d"
+  "/root/repo/src/containers/hashmap.c" "CMakeFiles/containers.dir/src/containers/hashmap.c.o" "gcc" "CMakeFiles/containers.dir/src/containers/hashmap.c.o.d"
+  "/root/repo/src/containers/intern.c" "CMakeFiles/containers.dir/src/containers/intern.c.o" "gcc" "CMakeFiles/containers.dir/src/containers/intern.c.o.d"
+  "/root/repo/src/containers/intervalset.c" "CMakeFiles/containers.dir/src/containers/intervalset.c.o" "gcc" "CMakeFiles/containers.dir/src/containers/intervalset.c.o.d"
+  "/root/repo/src/containers/numset.c" "CMakeFiles/containers.dir/src/containers/numset.c.o" "gcc" "CMakeFiles/containers.dir/src/containers/numset.c.o.d"
+  "/root/repo/src/containers/padgrid.c" "CMakeFiles/containers.dir/src/containers/padgrid.c.o" "gcc" "CMakeFiles/containers.dir/src/containers/padgrid.c.o.d"
+  "/root/repo/src/containers/podmap.c" "CMakeFiles/containers.dir/src/containers/podmap.c.o" "gcc" "CMakeFiles/containers.dir/src/containers/podmap.c.o.d"
+  "/root/repo/src/containers/queue.c" "CMakeFiles/containers.dir/src/containers/queue.c.o" "gcc" "CMakeFiles/containers.dir/src/containers/queue.c.o.d"
+  "/root/repo/src/containers/roaring.c" "CMakeFiles/containers.dir/src/containers/roaring.c.o" "gcc" "CMakeFiles/containers.dir/src/containers/roaring.c.o.d"
+  "/root/repo/src/containers/set.c" "CMakeFiles/containers.dir/src/containers/set.c.o" "gcc" "CMakeFiles/containers.dir/src/containers/set.c.o.d"
+  "/root/repo/src/containers/stack.c" "CMakeFiles/containers.dir/src/containers/stack.c.o" "gcc" "CMakeFiles/containers.dir/src/containers/stack.c.o.d"
+  "/root/repo/src/containers/stringbuilder.c" "CMakeFiles/containers.dir/src/containers/stringbuilder.c.o" "gcc" "CMakeFiles/containers.dir/src/containers/stringbuilder.c.o.d"
+  "/root/repo/src/containers/vector.c" "CMakeFiles/containers.dir/src/containers/vector.c.o" "gcc" "CMakeFiles/containers.dir/src/containers/vector.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,43 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/containers.dir/src/containers/bitgrid.c.o"
+  "CMakeFiles/containers.dir/src/containers/bitgrid.c.o.d"
+  "CMakeFiles/containers.dir/src/containers/bitset.c.o"
+  "CMakeFiles/containers.dir/src/containers/bitset.c.o.d"
+  "CMakeFiles/containers.dir/src/containers/dsu.c.o"
+  "CMakeFiles/containers.dir/src/containers/dsu.c.o.d"
+  "CMakeFiles/containers.dir/src/containers/grid.c.o"
+  "CMakeFiles/containers.dir/src/containers/grid.c.o.d"
+  "CMakeFiles/containers.dir/src/containers/grid_bfs.c.o"
+  "CMakeFiles/containers.dir/src/containers/grid_bfs.c.o.d"
+  "CMakeFiles/containers.dir/src/containers/hashmap.c.o"
+  "CMakeFiles/containers.dir/src/containers/hashmap.c.o.d"
+  "CMakeFiles/containers.dir/src/containers/intern.c.o"
+  "CMakeFiles/containers.dir/src/containers/intern.c.o.d"
+  "CMakeFiles/containers.dir/src/containers/intervalset.c.o"
+  "CMakeFiles/containers.dir/src/containers/intervalset.c.o.d"
+  "CMakeFiles/containers.dir/src/containers/numset.c.o"
+  "CMakeFiles/containers.dir/src/containers/numset.c.o.d"
+  "CMakeFiles/containers.dir/src/containers/padgrid.c.o"
+  "CMakeFiles/containers.dir/src/containers/padgrid.c.o.d"
+  "CMakeFiles/containers.dir/src/containers/podmap.c.o"
+  "CMakeFiles/containers.dir/src/containers/podmap.c.o.d"
+  "CMakeFiles/containers.dir/src/containers/queue.c.o"
+  "CMakeFiles/containers.dir/src/containers/queue.c.o.d"
+  "CMakeFiles/containers.dir/src/containers/roaring.c.o"
+  "CMakeFiles/containers.dir/src/containers/roaring.c.o.d"
+  "CMakeFiles/containers.dir/src/containers/set.c.o"
+  "CMakeFiles/containers.dir/src/containers/set.c.o.d"
+  "CMakeFiles/containers.dir/src/containers/stack.c.o"
+  "CMakeFiles/containers.dir/src/containers/stack.c.o.d"
+  "CMakeFiles/containers.dir/src/containers/stringbuilder.c.o"
+  "CMakeFiles/containers.dir/src/containers/stringbuilder.c.o.d"
+  "CMakeFiles/containers.dir/src/containers/vector.c.o"
+  "CMakeFiles/containers.dir/src/containers/vector.c.o.d"
+  "lib/libcontainers.a"
+  "lib/libcontainers.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/containers.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/containers_test.dir/src/tests/containers_test.c.o"
+  "CMakeFiles/containers_test.dir/src/tests/containers_test.c.o.d"
+  "bin/containers_test"
+  "bin/containers_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/containers_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
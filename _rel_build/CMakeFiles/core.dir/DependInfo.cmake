@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/aoc_cache.c" "CMakeFiles/core.dir/src/aoc_cache.c.o" "gcc" "CMakeFiles/core.dir/src/aoc_cache.c.o.d"
+  "/root/repo/src/aoc_net.c" "CMakeFiles/core.dir/src/aoc_net.c.o" "gcc" "CMakeFiles/core.dir/src/aoc_net.c.o.d"
+  "/root/repo/src/runner.c" "CMakeFiles/core.dir/src/runner.c.o" "gcc" "CMakeFiles/core.dir/src/runner.c.o.d"
+  "/root/repo/src/thread_pool.c" "CMakeFiles/core.dir/src/thread_pool.c.o" "gcc" "CMakeFiles/core.dir/src/thread_pool.c.o.d"
+  "/root/repo/src/util.c" "CMakeFiles/core.dir/src/util.c.o" "gcc" "CMakeFiles/core.dir/src/util.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/core.dir/src/aoc_cache.c.o"
+  "CMakeFiles/core.dir/src/aoc_cache.c.o.d"
+  "CMakeFiles/core.dir/src/aoc_net.c.o"
+  "CMakeFiles/core.dir/src/aoc_net.c.o.d"
+  "CMakeFiles/core.dir/src/runner.c.o"
+  "CMakeFiles/core.dir/src/runner.c.o.d"
+  "CMakeFiles/core.dir/src/thread_pool.c.o"
+  "CMakeFiles/core.dir/src/thread_pool.c.o.d"
+  "CMakeFiles/core.dir/src/util.c.o"
+  "CMakeFiles/core.dir/src/util.c.o.d"
+  "lib/libcore.a"
+  "lib/libcore.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/core.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/grid_layout_bench.dir/src/bench/grid_layout_bench.c.o"
+  "CMakeFiles/grid_layout_bench.dir/src/bench/grid_layout_bench.c.o.d"
+  "bin/grid_layout_bench"
+  "bin/grid_layout_bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/grid_layout_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
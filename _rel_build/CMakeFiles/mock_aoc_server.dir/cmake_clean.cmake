@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mock_aoc_server.dir/src/tests/mock_aoc_server.c.o"
+  "CMakeFiles/mock_aoc_server.dir/src/tests/mock_aoc_server.c.o.d"
+  "lib/libmock_aoc_server.a"
+  "lib/libmock_aoc_server.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mock_aoc_server.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "lib/libmock_aoc_server.a"
+)
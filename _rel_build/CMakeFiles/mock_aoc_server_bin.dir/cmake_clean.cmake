@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mock_aoc_server_bin.dir/src/tests/mock_aoc_server_main.c.o"
+  "CMakeFiles/mock_aoc_server_bin.dir/src/tests/mock_aoc_server_main.c.o.d"
+  "bin/mock_aoc_server"
+  "bin/mock_aoc_server.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mock_aoc_server_bin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run-2025_day01-part1"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/run-2025_day01-part1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
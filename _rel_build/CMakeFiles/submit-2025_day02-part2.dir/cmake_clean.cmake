@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/submit-2025_day02-part2"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/submit-2025_day02-part2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
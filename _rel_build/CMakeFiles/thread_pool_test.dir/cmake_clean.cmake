@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/thread_pool_test.dir/src/tests/thread_pool_test.c.o"
+  "CMakeFiles/thread_pool_test.dir/src/tests/thread_pool_test.c.o.d"
+  "CMakeFiles/thread_pool_test.dir/src/thread_pool.c.o"
+  "CMakeFiles/thread_pool_test.dir/src/thread_pool.c.o.d"
+  "bin/thread_pool_test"
+  "bin/thread_pool_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/thread_pool_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,14 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_rel_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(containers_test "/root/repo/_rel_build/bin/containers_test")
+set_tests_properties(containers_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;173;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(thread_pool_test "/root/repo/_rel_build/bin/thread_pool_test")
+set_tests_properties(thread_pool_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;186;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(aoc_client_test "/root/repo/_rel_build/bin/aoc_client_test")
+set_tests_properties(aoc_client_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;206;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(cached_run_without_network "/usr/bin/cmake" "-DDAY_BIN=/root/repo/_rel_build/bin/2025_day01" "-DWORK_DIR=/root/repo/_rel_build/cached_run_test" "-P" "/root/repo/src/tests/cached_run_test.cmake")
+set_tests_properties(cached_run_without_network PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;210;add_test;/root/repo/CMakeLists.txt;0;")
@@ -30,7 +30,8 @@ static int num_digits(long long x) {
     return d;
 }
 
-static long long sum_invalid_in_range_k(long long lo, long long hi, const int k_max_global) {
+/* S is scratch space shared across ranges; it is cleared here. */
+static long long sum_invalid_in_range_k(numset *S, long long lo, long long hi, const int k_max_global) {
     init_pow10();
 
     if (hi < lo) {
@@ -42,7 +43,9 @@ static long long sum_invalid_in_range_k(long long lo, long long hi, const int k_
 
     const int max_digits_hi = num_digits(hi);
 
-    numset *S = numset_new();
+    // A number like 111111 repeats "1", "11" and "111"; count it once.
+    numset_clear(S);
+    long long total = 0;
 
     for (int m = 1; m <= max_digits_hi / 2; m++) {
         const int k_min = 2;
@@ -69,27 +72,20 @@ static long long sum_invalid_in_range_k(long long lo, long long hi, const int k_
                 if (candidate > hi) {
                     break;
                 }
-                if (candidate >= lo) {
-                    numset_add(S, candidate);
+                if (candidate >= lo && numset_add(S, candidate)) {
+                    total += candidate;
                 }
             }
         }
     }
 
-    long long total = 0;
-    numset_iter it = numset_iterator(S);
-    long long v;
-    while (numset_next(&it, &v)) {
-        total += v;
-    }
-
-    numset_free(S);
     return total;
 }
 
 static long long solve_all_ranges(const char *input, const int k_max_global) {
     long long total = 0;
     const char *p = input;
+    numset *S = numset_new();
 
     while (*p) {
         // Skip separators
@@ -121,9 +117,10 @@ static long long solve_all_ranges(const char *input, const int k_max_global) {
         }
         p = endptr;
 
-        total += sum_invalid_in_range_k(lo, hi, k_max_global);
+        total += sum_invalid_in_range_k(S, lo, hi, k_max_global);
     }
 
+    numset_free(S);
     return total;
 }
 
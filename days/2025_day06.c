@@ -1,3 +1,4 @@
+#include "containers/bitset.h"
 #include "solver.h"
 #include "util.h"
 
@@ -14,7 +15,7 @@ typedef struct {
     size_t rows;
     size_t cols;
     char *grid;
-    bool *sep;
+    bitset *sep;  // columns that are blank in every row
 } Worksheet;
 
 static bool parse_worksheet(const char *input, Worksheet *ws) {
@@ -78,21 +79,13 @@ static bool parse_worksheet(const char *input, Worksheet *ws) {
         }
     }
 
-    bool *sep = malloc(cols * sizeof(bool));
-    if (!sep) {
-        free(grid);
-        return false;
-    }
-
-    for (size_t col = 0; col < cols; ++col) {
-        bool all_space = true;
-        for (size_t row = 0; row < rows; ++row) {
-            if (grid[row * cols + col] != ' ') {
-                all_space = false;
-                break;
-            }
+    // Row by row, knocking out every column that has something in it.
+    bitset *sep = bitset_new(cols);
+    bitset_set_all(sep);
+    for (size_t i = 0; i < rows * cols; ++i) {
+        if (grid[i] != ' ') {
+            bitset_clear(sep, i % cols);
         }
-        sep[col] = all_space;
     }
 
     ws->rows = rows;
@@ -104,7 +97,7 @@ static bool parse_worksheet(const char *input, Worksheet *ws) {
 
 static void free_worksheet(Worksheet *ws) {
     free(ws->grid);
-    free(ws->sep);
+    bitset_free(ws->sep);
     ws->grid = NULL;
     ws->sep = NULL;
     ws->rows = ws->cols = 0;
@@ -126,15 +119,15 @@ static long long compute_grand_total_rowwise(const char *input) {
     size_t col = 0;
 
     while (col < ws.cols) {
-        if (ws.sep[col]) {
+        if (bitset_test(ws.sep, col)) {
             col++;
             continue;
         }
 
+        // A problem runs up to the next blank column.
         const size_t start = col;
-        while (col < ws.cols && !ws.sep[col]) {
-            col++;
-        }
+        const size_t next_sep = bitset_next_set(ws.sep, col);
+        col = next_sep == SIZE_MAX ? ws.cols : next_sep;
         const size_t end = col;
 
         char op = 0;
@@ -203,15 +196,15 @@ static long long compute_grand_total_colwise(const char *input) {
     size_t col = 0;
 
     while (col < ws.cols) {
-        if (ws.sep[col]) {
+        if (bitset_test(ws.sep, col)) {
             col++;
             continue;
         }
 
+        // A problem runs up to the next blank column.
         const size_t start = col;
-        while (col < ws.cols && !ws.sep[col]) {
-            col++;
-        }
+        const size_t next_sep = bitset_next_set(ws.sep, col);
+        col = next_sep == SIZE_MAX ? ws.cols : next_sep;
         const size_t end = col;
 
         char op = 0;
@@ -1,3 +1,4 @@
+#include "containers/bitset.h"
 #include "solver.h"
 #include "util.h"
 
@@ -120,47 +121,39 @@ static long long count_splits(const char *input) {
         return 0;
     }
 
-    bool *curr = calloc(g.cols, sizeof(bool));
-    bool *next = calloc(g.cols, sizeof(bool));
-    if (!curr || !next) {
-        free(curr);
-        free(next);
-        free_grid(&g);
-        return 0;
-    }
+    // Beams as one bit per column, a whole row moved a word at a time:
+    // beams on a splitter go out both sides, the rest carry straight on.
+    bitset *curr = bitset_new(g.cols);
+    bitset *split = bitset_new(g.cols);
+    bitset *side = bitset_new(g.cols);
 
     long long splits = 0;
 
-    curr[start_col] = true;
+    bitset_set(curr, start_col);
 
     for (size_t r = start_row + 1; r < g.rows; ++r) {
-        memset(next, 0, g.cols * sizeof(bool));
-
-        for (size_t c = 0; c < g.cols; ++c) {
-            if (!curr[c]) continue;
-
-            const char ch = g.grid[r * g.cols + c];
-
-            if (ch == '^') {
-                splits++;
-                if (c > 0) {
-                    next[c - 1] = true;
-                }
-                if (c + 1 < g.cols) {
-                    next[c + 1] = true;
-                }
-            } else {
-                next[c] = true;
-            }
+        bitset_clear_all(split);
+        const char *row = g.grid + r * g.cols;
+        for (const char *hit = memchr(row, '^', g.cols); hit;
+             hit = memchr(hit + 1, '^', g.cols - (size_t) (hit + 1 - row))) {
+            bitset_set(split, (size_t) (hit - row));
         }
 
-        bool *tmp = curr;
-        curr = next;
-        next = tmp;
+        bitset_and(split, curr);
+        splits += (long long) bitset_count(split);
+        bitset_and_not(curr, split);
+
+        bitset_copy(side, split);
+        bitset_shl(side, 1);
+        bitset_or(curr, side);
+        bitset_copy(side, split);
+        bitset_shr(side, 1);
+        bitset_or(curr, side);
     }
 
-    free(curr);
-    free(next);
+    bitset_free(curr);
+    bitset_free(split);
+    bitset_free(side);
     free_grid(&g);
     return splits;
 }
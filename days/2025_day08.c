@@ -1,10 +1,13 @@
+#include "containers/bitset.h"
+#include "containers/dsu.h"
+#include "containers/pq.h"
 #include "solver.h"
+#include "thread_pool.h"
 #include "util.h"
 
 #include <stdio.h>
 #include <string.h>
 #include <stdbool.h>
-#include <pthread.h>
 #include <stdlib.h>
 #include <unistd.h>
 #include <limits.h>
@@ -99,27 +102,6 @@ static size_t parse_points(const char *input, Point **out_points) {
     return len;
 }
 
-static int dsu_find(int *parent, const int x) {
-    if (parent[x] != x) {
-        parent[x] = dsu_find(parent, parent[x]);
-    }
-    return parent[x];
-}
-
-static int dsu_union_if_diff(int *parent, int *size, const int a, const int b) {
-    int ra = dsu_find(parent, a);
-    int rb = dsu_find(parent, b);
-    if (ra == rb) return 0;
-    if (size[ra] < size[rb]) {
-        const int tmp = ra;
-        ra = rb;
-        rb = tmp;
-    }
-    parent[rb] = ra;
-    size[ra] += size[rb];
-    return 1;
-}
-
 static unsigned long long sq_dist(const Point *p, const Point *q) {
     const long long dx = p->x - q->x;
     const long long dy = p->y - q->y;
@@ -129,45 +111,63 @@ static unsigned long long sq_dist(const Point *p, const Point *q) {
            + (unsigned long long) (dz * dz);
 }
 
-static void heap_sift_up(Edge *heap, size_t idx) {
-    while (idx > 0) {
-        const size_t parent = (idx - 1) / 2;
-        if (heap[parent].dist >= heap[idx].dist) break;
-        const Edge tmp = heap[parent];
-        heap[parent] = heap[idx];
-        heap[idx] = tmp;
-        idx = parent;
+/* Total order on edges so the K shortest are the same whatever order the
+ * pairs are scanned in (ties broken by endpoints). */
+#define EDGE_LESS(x, y) \
+    ((x).dist != (y).dist ? (x).dist < (y).dist \
+     : (x).a != (y).a ? (x).a < (y).a : (x).b < (y).b)
+#define EDGE_GREATER(x, y) EDGE_LESS(y, x)
+
+// Max-heap: the top is the longest edge kept so far.
+PQ_DEFINE(longest, Edge, EDGE_GREATER)
+IPQ_DEFINE(dist, unsigned long long, PQ_LESS_SCALAR)
+
+#define SHORTEST_K 1000
+
+/* The SHORTEST_K smallest edges seen so far. A fixed array rather than a
+ * pq_longest so parallel_reduce can hand out copies without mallocs. */
+typedef struct {
+    size_t size;
+    Edge heap[SHORTEST_K];
+} ShortestEdges;
+
+static void shortest_push(ShortestEdges *s, const Edge *e) {
+    if (s->size < SHORTEST_K) {
+        s->heap[s->size] = *e;
+        pq_longest_sift_up(s->heap, s->size++);
+    } else if (EDGE_LESS(*e, s->heap[0])) {
+        pq_longest_sift_down(s->heap, s->size, 0, *e);
     }
 }
 
-static void heap_sift_down(Edge *heap, const size_t heap_size) {
-    size_t idx = 0;
-    for (;;) {
-        const size_t left = idx * 2 + 1;
-        const size_t right = idx * 2 + 2;
-        size_t largest = idx;
+typedef struct {
+    const Point *pts;
+    size_t n;
+} PairScan;
 
-        if (left < heap_size && heap[left].dist > heap[largest].dist) {
-            largest = left;
-        }
-        if (right < heap_size && heap[right].dist > heap[largest].dist) {
-            largest = right;
-        }
-        if (largest == idx) break;
+static void shortest_init(void *acc, void *ctx) {
+    (void) ctx;
+    ((ShortestEdges *) acc)->size = 0;
+}
 
-        const Edge tmp = heap[idx];
-        heap[idx] = heap[largest];
-        heap[largest] = tmp;
-        idx = largest;
+/* Rows [begin, end) of the upper triangle. */
+static void shortest_rows(size_t begin, size_t end, void *acc, void *ctx) {
+    const PairScan *scan = ctx;
+    ShortestEdges *s = acc;
+    for (size_t i = begin; i < end; ++i) {
+        for (size_t j = i + 1; j < scan->n; ++j) {
+            const Edge e = {sq_dist(&scan->pts[i], &scan->pts[j]), (int) i, (int) j};
+            shortest_push(s, &e);
+        }
     }
 }
 
-static int edge_cmp(const void *a, const void *b) {
-    const Edge *ea = a;
-    const Edge *eb = b;
-    if (ea->dist < eb->dist) return -1;
-    if (ea->dist > eb->dist) return 1;
-    return 0;
+static void shortest_combine(void *acc, const void *other, void *ctx) {
+    (void) ctx;
+    const ShortestEdges *o = other;
+    for (size_t i = 0; i < o->size; ++i) {
+        shortest_push(acc, &o->heap[i]);
+    }
 }
 
 static long long solve_playground_part1(const char *input) {
@@ -182,72 +182,29 @@ static long long solve_playground_part1(const char *input) {
         return 1;
     }
 
-    const size_t K = 1000;
-    Edge *heap = malloc(K * sizeof(Edge));
-    if (!heap) {
-        free(pts);
-        return 0;
-    }
-    size_t heap_size = 0;
-    for (size_t i = 0; i < n; ++i) {
-        for (size_t j = i + 1; j < n; ++j) {
-            const unsigned long long d = sq_dist(&pts[i], &pts[j]);
-            const Edge e = {d, (int) i, (int) j};
-
-            if (heap_size < K) {
-                heap[heap_size] = e;
-                heap_sift_up(heap, heap_size);
-                heap_size++;
-            } else if (d < heap[0].dist) {
-                heap[0] = e;
-                heap_sift_down(heap, heap_size);
-            }
-        }
-    }
-
-    qsort(heap, heap_size, sizeof(Edge), edge_cmp);
-
-    int *parent = malloc(n * sizeof(int));
-    int *size = malloc(n * sizeof(int));
-    if (!parent || !size) {
-        free(parent);
-        free(size);
-        free(heap);
+    ShortestEdges *shortest = malloc(sizeof(ShortestEdges));
+    if (!shortest) {
         free(pts);
         return 0;
     }
-
-    for (size_t i = 0; i < n; ++i) {
-        parent[i] = (int) i;
-        size[i] = 1;
-    }
-
-    for (size_t i = 0; i < heap_size; ++i) {
-        dsu_union_if_diff(parent, size, heap[i].a, heap[i].b);
-    }
-
-    long long top1 = 0, top2 = 0, top3 = 0;
-    for (size_t i = 0; i < n; ++i) {
-        if (parent[i] == (int) i) {
-            const long long s = size[i];
-            if (s > top1) {
-                top3 = top2;
-                top2 = top1;
-                top1 = s;
-            } else if (s > top2) {
-                top3 = top2;
-                top2 = s;
-            } else if (s > top3) {
-                top3 = s;
-            }
-        }
+    PairScan scan = {pts, n};
+    parallel_reduce(0, n, 0, shortest, sizeof(ShortestEdges),
+                    shortest_init, shortest_rows, shortest_combine, &scan);
+    // Components don't depend on the order the edges are joined in.
+    const Edge *edges = shortest->heap;
+    const size_t edge_count = shortest->size;
+
+    dsu *circuits = dsu_new(n);
+    for (size_t i = 0; i < edge_count; ++i) {
+        dsu_union(circuits, (uint32_t) edges[i].a, (uint32_t) edges[i].b);
     }
 
-    const long long result = top1 * top2 * top3;
+    size_t top[3] = {0, 0, 0};
+    dsu_top_sizes(circuits, 3, top);
+    const long long result = (long long) (top[0] * top[1] * top[2]);
 
-    free(parent);
-    free(size);
-    free(heap);
+    dsu_free(circuits);
+    free(shortest);
     free(pts);
     return result;
 }
@@ -265,46 +222,30 @@ static long long solve_playground_part2(const char *input) {
         return x * x;
     }
 
-    unsigned long long *best = malloc(n * sizeof(unsigned long long));
     int *from = malloc(n * sizeof(int));
-    bool *in_mst = calloc(n, sizeof(bool));
-    if (!best || !from || !in_mst) {
-        free(best);
-        free(from);
-        free(in_mst);
+    if (!from) {
         free(pts);
         return 0;
     }
+    bitset *in_mst = bitset_new(n);
 
     for (size_t i = 0; i < n; ++i) {
-        best[i] = ULLONG_MAX;
         from[i] = -1;
-        in_mst[i] = false;
     }
 
-    const size_t start = 0;
-    best[start] = 0;
+    // Prim: frontier keyed by the cheapest edge into the tree so far.
+    ipq_dist frontier;
+    ipq_dist_init(&frontier, n);
+    ipq_dist_push(&frontier, 0, 0);
 
     unsigned long long max_edge = 0;
     int last_u = -1;
     int last_v = -1;
 
-    for (size_t iter = 0; iter < n; ++iter) {
-        size_t u = (size_t) -1;
-        unsigned long long min_d = ULLONG_MAX;
-
-        for (size_t i = 0; i < n; ++i) {
-            if (!in_mst[i] && best[i] < min_d) {
-                min_d = best[i];
-                u = i;
-            }
-        }
-
-        if (u == (size_t) -1) {
-            break;
-        }
-
-        in_mst[u] = true;
+    while (!ipq_dist_empty(&frontier)) {
+        const uint32_t u = ipq_dist_pop(&frontier);
+        const unsigned long long min_d = ipq_dist_key(&frontier, u);
+        bitset_set(in_mst, u);
 
         if (from[u] != -1) {
             if (min_d >= max_edge) {
@@ -315,14 +256,14 @@ static long long solve_playground_part2(const char *input) {
         }
 
         for (size_t v = 0; v < n; ++v) {
-            if (in_mst[v]) continue;
+            if (bitset_test(in_mst, v)) continue;
             const unsigned long long d = sq_dist(&pts[u], &pts[v]);
-            if (d < best[v]) {
-                best[v] = d;
+            if (ipq_dist_push_or_decrease(&frontier, (uint32_t) v, d)) {
                 from[v] = (int) u;
             }
         }
     }
+    ipq_dist_free(&frontier);
 
     long long result = 0;
     if (last_u != -1 && last_v != -1) {
@@ -331,9 +272,8 @@ static long long solve_playground_part2(const char *input) {
         result = xa * xb;
     }
 
-    free(best);
     free(from);
-    free(in_mst);
+    bitset_free(in_mst);
     free(pts);
 
     return result;
@@ -0,0 +1,25 @@
+#include "aoc_cache.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+char *aoc_cache_input_path(const char *cache_dir, int year, int day) {
+    char *year_dir = format_string("%s/%d", cache_dir, year);
+    if (!year_dir) return NULL;
+    ensure_dir_exists(year_dir);
+
+    char *filename = format_string("day%02d.txt", day);
+    char *full = path_join(year_dir, filename);
+    free(year_dir);
+    free(filename);
+    return full;
+}
+
+int aoc_cache_read_input(const char *cache_dir, int year, int day, file_view *out) {
+    memset(out, 0, sizeof(*out));
+    char *path = aoc_cache_input_path(cache_dir, year, day);
+    if (!path) return -1;
+    const int rc = file_view_open(path, out);
+    free(path);
+    return rc;
+}
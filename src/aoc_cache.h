@@ -0,0 +1,20 @@
+#ifndef AOC_CACHE_H
+#define AOC_CACHE_H
+
+#include "util.h"
+
+#define AOC_DEFAULT_CACHE_DIR ".aoc_cache"
+
+/**
+ * Path of the cached input, <cache_dir>/<year>/dayNN.txt.
+ * Creates the year directory. Returns a malloc'd string.
+ */
+char *aoc_cache_input_path(const char *cache_dir, int year, int day);
+
+/**
+ * Open a cached input without touching the network.
+ * Returns 0 and fills *out on a cache hit, non-zero otherwise.
+ */
+int aoc_cache_read_input(const char *cache_dir, int year, int day, file_view *out);
+
+#endif // AOC_CACHE_H
@@ -1,25 +1,141 @@
+#define _GNU_SOURCE // strcasestr on glibc
+
 #include "aoc_client.h"
+#include "aoc_cache.h"
 #include "util.h"
 
 #include <curl/curl.h>
+#include <fcntl.h>
+#include <pthread.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define AOC_DEFAULT_BASE_URL "https://adventofcode.com"
+
+// Upper bound on concurrent transfers during aoc_prefetch_inputs. AoC asks
+// automated tools to be gentle, so keep this small.
+#define AOC_PREFETCH_MAX_PARALLEL 4
+
+/* Persistent handle for submissions. Its connection is opened ahead of time
+ * by aoc_submit_prewarm() and reused by every aoc_submit_answer(). */
+struct AocSubmitConn {
+    CURL *curl;
+    pthread_t warm_thread;
+    int warming;
+};
+
+/* Response body accumulated in memory (submissions). */
+typedef struct {
+    char *buf;
+    size_t len;
+    size_t cap;
+} ResponseBuf;
+
+static size_t write_to_buffer_cb(char *ptr, size_t size, size_t nmemb, void *userdata) {
+    const size_t total = size * nmemb;
+    ResponseBuf *rb = userdata;
+
+    if (rb->len + total + 1 > rb->cap) {
+        size_t new_cap = rb->cap ? rb->cap : 4096;
+        while (new_cap < rb->len + total + 1) {
+            new_cap *= 2;
+        }
+        char *new_buf = realloc(rb->buf, new_cap);
+        if (!new_buf) return 0; // allocation failure
+        rb->buf = new_buf;
+        rb->cap = new_cap;
+    }
 
-#define AOC_BASE_URL "https://adventofcode.com"
+    memcpy(rb->buf + rb->len, ptr, total);
+    rb->len += total;
+    rb->buf[rb->len] = '\0';
+    return total;
+}
 
-static size_t write_to_string_cb(void *ptr, size_t size, size_t nmemb, void *userdata) {
-    size_t total = size * nmemb;
-    char **pstr = (char **)userdata;
-    const size_t old_len = (*pstr) ? strlen(*pstr) : 0;
+/* Input download streamed into a temp file next to its cache file, then
+ * renamed into place, so a cache file is never partially written. */
+typedef struct {
+    char *tmp_path;
+    int fd;
+    size_t len;
+} CacheDownload;
+
+static size_t write_to_file_cb(char *ptr, size_t size, size_t nmemb, void *userdata) {
+    const size_t total = size * nmemb;
+    CacheDownload *dl = userdata;
+
+    const char *p = ptr;
+    size_t left = total;
+    while (left > 0) {
+        const ssize_t n = write(dl->fd, p, left);
+        if (n < 0) return 0; // makes curl abort with CURLE_WRITE_ERROR
+        p += n;
+        left -= (size_t)n;
+    }
+    dl->len += total;
+    return total;
+}
 
-    char *new_buf = realloc(*pstr, old_len + total + 1);
-    if (!new_buf) return 0; // allocation failure
+static int cache_download_begin(CacheDownload *dl, const char *cache_path) {
+    dl->len = 0;
+    dl->tmp_path = format_string("%s.XXXXXX", cache_path);
+    if (!dl->tmp_path) return -1;
 
-    memcpy(new_buf + old_len, ptr, total);
-    new_buf[old_len + total] = '\0';
-    *pstr = new_buf;
-    return total;
+    dl->fd = mkstemp(dl->tmp_path);
+    if (dl->fd < 0) {
+        fprintf(stderr, "Error: cannot create temp file %s\n", dl->tmp_path);
+        free(dl->tmp_path);
+        dl->tmp_path = NULL;
+        return -1;
+    }
+    fchmod(dl->fd, 0644); // mkstemp uses 0600; match the other cache files
+    return 0;
+}
+
+static void cache_download_abort(CacheDownload *dl) {
+    if (!dl->tmp_path) return;
+    close(dl->fd);
+    unlink(dl->tmp_path);
+    free(dl->tmp_path);
+    dl->tmp_path = NULL;
+}
+
+/* Cuts trailing newlines off the downloaded file, like strip_trailing_newlines. */
+static int truncate_trailing_newlines(int fd, size_t *len) {
+    char tail[64];
+    while (*len > 0) {
+        const size_t chunk = *len < sizeof(tail) ? *len : sizeof(tail);
+        if (pread(fd, tail, chunk, (off_t)(*len - chunk)) != (ssize_t)chunk) return -1;
+
+        size_t keep = chunk;
+        while (keep > 0 && (tail[keep - 1] == '\n' || tail[keep - 1] == '\r')) {
+            keep--;
+        }
+        *len -= chunk - keep;
+        if (keep > 0) break;
+    }
+    return ftruncate(fd, (off_t)*len);
+}
+
+static int cache_download_commit(CacheDownload *dl, const char *cache_path) {
+    if (truncate_trailing_newlines(dl->fd, &dl->len) != 0) {
+        cache_download_abort(dl);
+        return -1;
+    }
+    close(dl->fd);
+    if (rename(dl->tmp_path, cache_path) != 0) {
+        fprintf(stderr, "Error: failed to move %s to %s\n", dl->tmp_path, cache_path);
+        unlink(dl->tmp_path);
+        free(dl->tmp_path);
+        dl->tmp_path = NULL;
+        return -1;
+    }
+    free(dl->tmp_path);
+    dl->tmp_path = NULL;
+    return 0;
 }
 
 int aoc_client_init(AocClient *client) {
@@ -33,7 +149,16 @@ int aoc_client_init(AocClient *client) {
     }
 
     client->config.user_agent = str_dup("AdventOfCodeCHelper (local)");
-    client->config.cache_dir = str_dup(".aoc_cache");
+    client->config.cache_dir = str_dup(AOC_DEFAULT_CACHE_DIR);
+
+    // AOC_BASE_URL points the client at a stand-in server (tests, benchmarks).
+    const char *base_url = getenv("AOC_BASE_URL");
+    client->config.base_url = str_dup(base_url && *base_url ? base_url : AOC_DEFAULT_BASE_URL);
+    if (!client->config.base_url) return -1;
+    size_t base_len = strlen(client->config.base_url);
+    while (base_len > 0 && client->config.base_url[base_len - 1] == '/') {
+        client->config.base_url[--base_len] = '\0';
+    }
 
     if (ensure_dir_exists(client->config.cache_dir) != 0) {
         fprintf(stderr, "Warning: failed to create cache dir %s\n", client->config.cache_dir);
@@ -47,71 +172,88 @@ int aoc_client_init(AocClient *client) {
     return 0;
 }
 
+static void submit_conn_free(struct AocSubmitConn *conn);
+
 void aoc_client_free(AocClient *client) {
     if (!client) return;
+    submit_conn_free(client->submit);
+    client->submit = NULL;
     free(client->config.session_token);
     free(client->config.user_agent);
     free(client->config.cache_dir);
+    free(client->config.base_url);
     curl_global_cleanup();
 }
 
-static char *build_input_cache_path(AocClient *client, int year, int day) {
-    char *year_dir = format_string("%s/%d", client->config.cache_dir, year);
-    if (!year_dir) return NULL;
-    ensure_dir_exists(year_dir);
+static char *build_url_input(AocClient *client, int year, int day) {
+    return format_string("%s/%d/day/%d/input", client->config.base_url, year, day);
+}
 
-    char *filename = format_string("day%02d.txt", day);
-    char *full = path_join(year_dir, filename);
-    free(year_dir);
-    free(filename);
-    return full;
+static char *build_url_day(AocClient *client, int year, int day) {
+    return format_string("%s/%d/day/%d", client->config.base_url, year, day);
 }
 
-static char *build_url_input(int year, int day) {
-    return format_string("%s/%d/day/%d/input", AOC_BASE_URL, year, day);
+static char *build_url_answer(AocClient *client, int year, int day) {
+    return format_string("%s/%d/day/%d/answer", client->config.base_url, year, day);
 }
 
-static char *build_url_answer(int year, int day) {
-    return format_string("%s/%d/day/%d/answer", AOC_BASE_URL, year, day);
+static void setup_request(AocClient *client, CURL *curl, const char *url,
+                          curl_write_callback write_cb, void *write_data) {
+    curl_easy_setopt(curl, CURLOPT_URL, url);
+    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, write_cb);
+    curl_easy_setopt(curl, CURLOPT_WRITEDATA, write_data);
+    curl_easy_setopt(curl, CURLOPT_USERAGENT, client->config.user_agent);
+
+    char cookie_header[4096];
+    snprintf(cookie_header, sizeof(cookie_header), "session=%s", client->config.session_token);
+    curl_easy_setopt(curl, CURLOPT_COOKIE, cookie_header);
 }
 
-int aoc_get_input(AocClient *client, int year, int day, int force, char **out_input) {
-    *out_input = NULL;
+/* Moves a finished download into the cache, or discards it if the
+ * transfer failed. Returns 0 if the cache file is in place. */
+static int finish_input_fetch(const char *cache_path, CURLcode res, long status, CacheDownload *dl) {
+    if (res != CURLE_OK || status != 200) {
+        fprintf(stderr, "Error: failed to fetch input (curl=%d, HTTP=%ld)\n", res, status);
+        cache_download_abort(dl);
+        return -1;
+    }
+    if (cache_download_commit(dl, cache_path) != 0) {
+        fprintf(stderr, "Error: failed to write cache file %s\n", cache_path);
+        return -1;
+    }
+    return 0;
+}
+
+int aoc_get_input(AocClient *client, int year, int day, int force, file_view *out_input) {
+    memset(out_input, 0, sizeof(*out_input));
     if (!client) return -1;
 
-    char *cache_path = build_input_cache_path(client, year, day);
+    char *cache_path = aoc_cache_input_path(client->config.cache_dir, year, day);
     if (!cache_path) return -1;
 
     if (!force) {
-        if (read_file_to_string(cache_path, out_input) == 0) {
+        if (file_view_open(cache_path, out_input) == 0) {
             free(cache_path);
             return 0; // got from cache
         }
     }
 
-    char *url = build_url_input(year, day);
+    char *url = build_url_input(client, year, day);
     if (!url) {
         free(cache_path);
         return -1;
     }
 
     CURL *curl = curl_easy_init();
-    if (!curl) {
+    CacheDownload dl;
+    if (!curl || cache_download_begin(&dl, cache_path) != 0) {
+        if (curl) curl_easy_cleanup(curl);
         free(cache_path);
         free(url);
         return -1;
     }
 
-    char *response = NULL;
-
-    curl_easy_setopt(curl, CURLOPT_URL, url);
-    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, write_to_string_cb);
-    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &response);
-    curl_easy_setopt(curl, CURLOPT_USERAGENT, client->config.user_agent);
-
-    char cookie_header[4096];
-    snprintf(cookie_header, sizeof(cookie_header), "session=%s", client->config.session_token);
-    curl_easy_setopt(curl, CURLOPT_COOKIE, cookie_header);
+    setup_request(client, curl, url, write_to_file_cb, &dl);
 
     const CURLcode res = curl_easy_perform(curl);
     long status = 0;
@@ -119,24 +261,152 @@ int aoc_get_input(AocClient *client, int year, int day, int force, char **out_in
     curl_easy_cleanup(curl);
     free(url);
 
-    if (res != CURLE_OK || status != 200) {
-        fprintf(stderr, "Error: failed to fetch input (curl=%d, HTTP=%ld)\n", res, status);
-        free(response);
-        free(cache_path);
-        return -1;
+    int rc = finish_input_fetch(cache_path, res, status, &dl);
+    if (rc == 0) {
+        rc = file_view_open(cache_path, out_input);
     }
+    free(cache_path);
+    return rc;
+}
 
-    strip_trailing_newlines(response);
+typedef struct {
+    int day;
+    char *cache_path;
+    CacheDownload dl;
+    CURL *curl;
+} PrefetchJob;
 
-    if (write_string_to_file(cache_path, response) != 0) {
-        fprintf(stderr, "Warning: failed to write cache file %s\n", cache_path);
+static int prefetch_start(AocClient *client, CURLM *multi, PrefetchJob *job, int year) {
+    char *url = build_url_input(client, year, job->day);
+    if (!url) return -1;
+
+    job->curl = curl_easy_init();
+    if (!job->curl) {
+        free(url);
+        return -1;
+    }
+    if (cache_download_begin(&job->dl, job->cache_path) != 0) {
+        curl_easy_cleanup(job->curl);
+        job->curl = NULL;
+        free(url);
+        return -1;
     }
 
-    *out_input = response;
-    free(cache_path);
+    setup_request(client, job->curl, url, write_to_file_cb, &job->dl);
+    free(url); // libcurl copies CURLOPT_URL
+    curl_easy_setopt(job->curl, CURLOPT_PRIVATE, job);
+    // Wait for an in-flight connection to the host instead of opening a new one.
+    curl_easy_setopt(job->curl, CURLOPT_PIPEWAIT, 1L);
+
+    if (curl_multi_add_handle(multi, job->curl) != CURLM_OK) {
+        cache_download_abort(&job->dl);
+        curl_easy_cleanup(job->curl);
+        job->curl = NULL;
+        return -1;
+    }
     return 0;
 }
 
+int aoc_prefetch_inputs(AocClient *client, int year, const int *days, size_t n_days, int force) {
+    if (!client || (!days && n_days > 0)) return -1;
+
+    PrefetchJob *jobs = calloc(n_days ? n_days : 1, sizeof(PrefetchJob));
+    if (!jobs) return -1;
+
+    int failures = 0;
+    size_t n_jobs = 0;
+    for (size_t i = 0; i < n_days; i++) {
+        char *cache_path = aoc_cache_input_path(client->config.cache_dir, year, days[i]);
+        if (!cache_path) {
+            failures++;
+            continue;
+        }
+        struct stat st;
+        if (!force && stat(cache_path, &st) == 0) {
+            free(cache_path);
+            continue; // already cached
+        }
+        jobs[n_jobs].day = days[i];
+        jobs[n_jobs].cache_path = cache_path;
+        n_jobs++;
+    }
+
+    CURLM *multi = n_jobs > 0 ? curl_multi_init() : NULL;
+    if (n_jobs > 0 && !multi) {
+        for (size_t i = 0; i < n_jobs; i++) free(jobs[i].cache_path);
+        free(jobs);
+        return -1;
+    }
+
+    if (multi) {
+        // All transfers share the multi handle's connection cache; with
+        // HTTP/2 they are multiplexed over a single TLS connection.
+        curl_multi_setopt(multi, CURLMOPT_PIPELINING, (long)CURLPIPE_MULTIPLEX);
+        curl_multi_setopt(multi, CURLMOPT_MAX_HOST_CONNECTIONS, (long)AOC_PREFETCH_MAX_PARALLEL);
+    }
+
+    size_t next = 0;
+    size_t active = 0;
+    while (next < n_jobs || active > 0) {
+        while (next < n_jobs && active < AOC_PREFETCH_MAX_PARALLEL) {
+            PrefetchJob *job = &jobs[next++];
+            if (prefetch_start(client, multi, job, year) != 0) {
+                fprintf(stderr, "Error: could not start fetch for %d day %d\n", year, job->day);
+                failures++;
+                continue;
+            }
+            active++;
+        }
+        if (active == 0) break;
+
+        int running = 0;
+        CURLMcode mc = curl_multi_perform(multi, &running);
+        if (mc == CURLM_OK && running > 0) {
+            mc = curl_multi_poll(multi, NULL, 0, 1000, NULL);
+        }
+        if (mc != CURLM_OK) {
+            fprintf(stderr, "Error: curl_multi failed: %s\n", curl_multi_strerror(mc));
+            break;
+        }
+
+        CURLMsg *msg;
+        int msgs_left = 0;
+        while ((msg = curl_multi_info_read(multi, &msgs_left)) != NULL) {
+            if (msg->msg != CURLMSG_DONE) continue;
+
+            PrefetchJob *job = NULL;
+            curl_easy_getinfo(msg->easy_handle, CURLINFO_PRIVATE, (char **)&job);
+            long status = 0;
+            curl_easy_getinfo(msg->easy_handle, CURLINFO_RESPONSE_CODE, &status);
+
+            if (finish_input_fetch(job->cache_path, msg->data.result, status, &job->dl) != 0) {
+                fprintf(stderr, "  (while prefetching %d day %d)\n", year, job->day);
+                failures++;
+            }
+
+            curl_multi_remove_handle(multi, job->curl);
+            curl_easy_cleanup(job->curl);
+            job->curl = NULL;
+            active--;
+        }
+    }
+
+    // After a curl_multi failure, jobs from `next` on were never started.
+    failures += (int)(n_jobs - next);
+    for (size_t i = 0; i < n_jobs; i++) {
+        if (jobs[i].curl) {
+            curl_multi_remove_handle(multi, jobs[i].curl);
+            curl_easy_cleanup(jobs[i].curl);
+            cache_download_abort(&jobs[i].dl);
+            failures++;
+        }
+        free(jobs[i].cache_path);
+    }
+    if (multi) curl_multi_cleanup(multi);
+    free(jobs);
+    return failures;
+}
+
 static void parse_submission_html(const char *html,
                                   AocSubmissionStatus *out_status,
                                   char **out_message_text) {
@@ -189,6 +459,135 @@ static void parse_submission_html(const char *html,
     *out_message_text = msg;
 }
 
+/* Parses a run like "4m 32s" or "1h 2m" (units h/m/s). Returns seconds. */
+static int parse_duration_units(const char *p) {
+    int total = 0;
+    for (;;) {
+        while (*p == ' ') p++;
+        char *end;
+        const long n = strtol(p, &end, 10);
+        if (end == p) break;
+        if (*end == 'h') total += (int)n * 3600;
+        else if (*end == 'm') total += (int)n * 60;
+        else if (*end == 's') total += (int)n;
+        else break;
+        p = end + 1;
+    }
+    return total;
+}
+
+int aoc_parse_wait_seconds(const char *message) {
+    if (!message) return 0;
+
+    char *lower = str_dup(message);
+    if (!lower) return 0;
+    for (char *p = lower; *p; p++) {
+        if (*p >= 'A' && *p <= 'Z') *p = (char)(*p - 'A' + 'a');
+    }
+
+    int seconds = 0;
+    const char *p;
+    if (strstr(lower, "left to wait") != NULL) {
+        // "...you have to wait after submitting an answer before trying
+        // again.  You have 4m 32s left to wait." -- skip the first "you have".
+        for (p = strstr(lower, "you have "); p && seconds == 0; p = strstr(p + 1, "you have ")) {
+            seconds = parse_duration_units(p + strlen("you have "));
+        }
+    } else if ((p = strstr(lower, "please wait ")) != NULL) {
+        // "Please wait one minute before trying again." / "wait 5 minutes"
+        p += strlen("please wait ");
+        char *end;
+        long n = strtol(p, &end, 10);
+        if (end == p) {
+            if (strncmp(p, "one ", 4) == 0 || strncmp(p, "a ", 2) == 0) {
+                n = 1;
+                end = strchr(p, ' ');
+            } else {
+                n = 0;
+            }
+        }
+        if (n > 0 && end) {
+            while (*end == ' ') end++;
+            if (strncmp(end, "hour", 4) == 0) seconds = (int)n * 3600;
+            else if (strncmp(end, "minute", 6) == 0) seconds = (int)n * 60;
+            else if (strncmp(end, "second", 6) == 0) seconds = (int)n;
+        }
+    }
+
+    free(lower);
+    return seconds;
+}
+
+static size_t discard_cb(char *ptr, size_t size, size_t nmemb, void *userdata) {
+    (void)ptr;
+    (void)userdata;
+    return size * nmemb;
+}
+
+static void *submit_warm_thread(void *arg) {
+    CURL *curl = arg;
+    // Result is irrelevant: we only want DNS, TCP and TLS done before the
+    // answer exists. A failed warm-up just means the POST connects itself.
+    curl_easy_perform(curl);
+    return NULL;
+}
+
+static struct AocSubmitConn *submit_conn_get(AocClient *client) {
+    if (client->submit) return client->submit;
+
+    struct AocSubmitConn *conn = calloc(1, sizeof(*conn));
+    if (!conn) return NULL;
+
+    conn->curl = curl_easy_init();
+    if (!conn->curl) {
+        free(conn);
+        return NULL;
+    }
+
+    curl_easy_setopt(conn->curl, CURLOPT_TCP_NODELAY, 1L);
+    curl_easy_setopt(conn->curl, CURLOPT_TCP_KEEPALIVE, 1L);
+    curl_easy_setopt(conn->curl, CURLOPT_TCP_KEEPIDLE, 30L);
+    curl_easy_setopt(conn->curl, CURLOPT_TCP_KEEPINTVL, 15L);
+
+    client->submit = conn;
+    return conn;
+}
+
+/* Waits for a pending warm-up so the handle is safe to use again. */
+static void submit_conn_join(struct AocSubmitConn *conn) {
+    if (!conn || !conn->warming) return;
+    pthread_join(conn->warm_thread, NULL);
+    conn->warming = 0;
+}
+
+static void submit_conn_free(struct AocSubmitConn *conn) {
+    if (!conn) return;
+    submit_conn_join(conn);
+    curl_easy_cleanup(conn->curl);
+    free(conn);
+}
+
+int aoc_submit_prewarm(AocClient *client, int year, int day) {
+    if (!client) return -1;
+
+    struct AocSubmitConn *conn = submit_conn_get(client);
+    if (!conn) return -1;
+    if (conn->warming) return 0;
+
+    char *url = build_url_day(client, year, day);
+    if (!url) return -1;
+
+    setup_request(client, conn->curl, url, discard_cb, NULL);
+    free(url);
+    curl_easy_setopt(conn->curl, CURLOPT_NOBODY, 1L);
+
+    if (pthread_create(&conn->warm_thread, NULL, submit_warm_thread, conn->curl) != 0) {
+        return -1;
+    }
+    conn->warming = 1;
+    return 0;
+}
+
 int aoc_submit_answer(AocClient *client,
                       int year,
                       int day,
@@ -198,44 +597,37 @@ int aoc_submit_answer(AocClient *client,
     memset(out_result, 0, sizeof(*out_result));
     if (!client || !answer) return -1;
 
-    char *url = build_url_answer(year, day);
-    if (!url) return -1;
+    struct AocSubmitConn *conn = submit_conn_get(client);
+    if (!conn) return -1;
+    submit_conn_join(conn);
 
-    CURL *curl = curl_easy_init();
-    if (!curl) {
-        free(url);
-        return -1;
-    }
+    char *url = build_url_answer(client, year, day);
+    if (!url) return -1;
 
-    char *response = NULL;
+    ResponseBuf response = {0};
 
     char *post_fields = format_string("level=%d&answer=%s", level, answer);
     if (!post_fields) {
-        curl_easy_cleanup(curl);
         free(url);
         return -1;
     }
 
-    curl_easy_setopt(curl, CURLOPT_URL, url);
+    CURL *curl = conn->curl;
+    setup_request(client, curl, url, write_to_buffer_cb, &response);
+    curl_easy_setopt(curl, CURLOPT_NOBODY, 0L);
     curl_easy_setopt(curl, CURLOPT_POSTFIELDS, post_fields);
-    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, write_to_string_cb);
-    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &response);
-    curl_easy_setopt(curl, CURLOPT_USERAGENT, client->config.user_agent);
-
-    char cookie_header[4096];
-    snprintf(cookie_header, sizeof(cookie_header), "session=%s", client->config.session_token);
-    curl_easy_setopt(curl, CURLOPT_COOKIE, cookie_header);
 
     const CURLcode res = curl_easy_perform(curl);
     long status = 0;
     curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &status);
-    curl_easy_cleanup(curl);
+    // post_fields is only referenced, not copied, by libcurl.
+    curl_easy_setopt(curl, CURLOPT_POSTFIELDS, NULL);
     free(url);
     free(post_fields);
 
-    if (res != CURLE_OK || status != 200) {
+    if (res != CURLE_OK || status != 200 || !response.buf) {
         fprintf(stderr, "Error: failed to submit answer (curl=%d, HTTP=%ld)\n", res, status);
-        free(response);
+        free(response.buf);
         out_result->status = AOC_SUBMISSION_ERROR;
         out_result->message = str_dup("Network/HTTP error");
         out_result->raw_html = NULL;
@@ -244,11 +636,12 @@ int aoc_submit_answer(AocClient *client,
 
     AocSubmissionStatus status_enum;
     char *message_text = NULL;
-    parse_submission_html(response, &status_enum, &message_text);
+    parse_submission_html(response.buf, &status_enum, &message_text);
 
     out_result->status = status_enum;
     out_result->message = message_text;
-    out_result->raw_html = response;
+    out_result->raw_html = response.buf;
+    out_result->wait_seconds = aoc_parse_wait_seconds(message_text);
     return 0;
 }
 
@@ -1,6 +1,8 @@
 #ifndef AOC_CLIENT_H
 #define AOC_CLIENT_H
 
+#include "util.h"
+
 #include <stddef.h>
 
 typedef enum {
@@ -16,16 +18,21 @@ typedef struct {
     AocSubmissionStatus status;
     char *message;
     char *raw_html;
+    int wait_seconds; // cooldown announced by the server, 0 if none
 } AocSubmissionResult;
 
 typedef struct {
     char *session_token;
     char *user_agent;
     char *cache_dir;
+    char *base_url; // without trailing slash; AOC_BASE_URL env var overrides
 } AocClientConfig;
 
+struct AocSubmitConn;
+
 typedef struct {
     AocClientConfig config;
+    struct AocSubmitConn *submit; // keep-alive handle for submissions, lazily created
 } AocClient;
 
 int aoc_client_init(AocClient *client);
@@ -33,13 +40,37 @@ void aoc_client_free(AocClient *client);
 
 /**
  * Fetch puzzle input (possibly from cache).
- * 
- * Returns a heap-allocated string (NUL-terminated) in *out_input.
- * Caller must free(*out_input).
- * 
+ *
+ * Downloads are streamed into a temp file and renamed into the cache. The
+ * cached file is then handed back as a read-only, NUL-terminated view
+ * (usually an mmap). Caller must file_view_close(out_input).
+ *
  * Returns 0 on success, non-zero on error.
  */
-int aoc_get_input(AocClient *client, int year, int day, int force, char **out_input);
+int aoc_get_input(AocClient *client, int year, int day, int force, file_view *out_input);
+
+/**
+ * Fetch inputs for several days of one year into the cache.
+ *
+ * Days that are already cached are skipped unless force is set. The
+ * remaining downloads run concurrently on one curl_multi handle, so they
+ * share connections instead of paying a TLS handshake each.
+ *
+ * Returns the number of days that failed (0 on full success),
+ * or -1 on a setup error.
+ */
+int aoc_prefetch_inputs(AocClient *client, int year, const int *days, size_t n_days, int force);
+
+/**
+ * Start opening the submission connection in the background.
+ *
+ * Sends a HEAD request for the day page on a persistent keep-alive handle
+ * so that DNS, TCP and TLS setup overlap with solving. The following
+ * aoc_submit_answer() reuses that connection.
+ *
+ * Returns 0 if the warm-up was started, non-zero otherwise.
+ */
+int aoc_submit_prewarm(AocClient *client, int year, int day);
 
 /**
  * Submit answer and parse response.
@@ -56,4 +87,11 @@ int aoc_submit_answer(AocClient *client,
 
 void aoc_submission_result_free(AocSubmissionResult *res);
 
+/**
+ * Extract the cooldown from a submission message, e.g.
+ * "You have 4m 32s left to wait." or "Please wait one minute before
+ * trying again.". Returns seconds, 0 if the message names none.
+ */
+int aoc_parse_wait_seconds(const char *message);
+
 #endif // AOC_CLIENT_H
@@ -0,0 +1,73 @@
+#include "aoc_net.h"
+
+#include <dlfcn.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef AOC_NET_LIBRARY
+#ifdef __APPLE__
+#define AOC_NET_LIBRARY "libaoc_net.dylib"
+#else
+#define AOC_NET_LIBRARY "libaoc_net.so"
+#endif
+#endif
+
+static void *open_library(void) {
+    // An explicit path is the only one tried, so a bad one means no network.
+    const char *override = getenv("AOC_NET_LIBRARY");
+    if (override && *override) {
+        return dlopen(override, RTLD_NOW | RTLD_LOCAL);
+    }
+
+    const char *candidates[] = {
+        AOC_NET_LIBRARY,
+#ifdef __APPLE__
+        "libaoc_net.dylib",
+#else
+        "libaoc_net.so",
+#endif
+    };
+
+    for (size_t i = 0; i < sizeof(candidates) / sizeof(candidates[0]); i++) {
+        void *handle = dlopen(candidates[i], RTLD_NOW | RTLD_LOCAL);
+        if (handle) return handle;
+    }
+    return NULL;
+}
+
+#define AOC_NET_BIND(net, field, symbol)                                   \
+    do {                                                                   \
+        *(void **)(&(net)->field) = dlsym((net)->handle, symbol);          \
+        if (!(net)->field) {                                               \
+            fprintf(stderr, "aoc_net_load: missing symbol %s\n", symbol);  \
+            aoc_net_unload(net);                                           \
+            return -1;                                                     \
+        }                                                                  \
+    } while (0)
+
+int aoc_net_load(AocNet *net) {
+    if (!net) return -1;
+    memset(net, 0, sizeof(*net));
+
+    net->handle = open_library();
+    if (!net->handle) {
+        fprintf(stderr, "Error: cannot load network library (%s)\n", dlerror());
+        return -1;
+    }
+
+    AOC_NET_BIND(net, client_init, "aoc_client_init");
+    AOC_NET_BIND(net, client_free, "aoc_client_free");
+    AOC_NET_BIND(net, get_input, "aoc_get_input");
+    AOC_NET_BIND(net, submit_prewarm, "aoc_submit_prewarm");
+    AOC_NET_BIND(net, submit_answer, "aoc_submit_answer");
+    AOC_NET_BIND(net, submit_answer_when_allowed, "aoc_submit_answer_when_allowed");
+    AOC_NET_BIND(net, submission_result_free, "aoc_submission_result_free");
+    return 0;
+}
+
+void aoc_net_unload(AocNet *net) {
+    if (!net) return;
+    if (net->handle) dlclose(net->handle);
+    memset(net, 0, sizeof(*net));
+}
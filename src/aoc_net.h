@@ -0,0 +1,33 @@
+#ifndef AOC_NET_H
+#define AOC_NET_H
+
+#include "aoc_client.h"
+
+/**
+ * Networking (libcurl + TLS) lives in the aoc_net shared library, which the
+ * runner only dlopen()s when it actually has to talk to the server. Runs on
+ * cached input never load it.
+ *
+ * If $AOC_NET_LIBRARY is set, the library is loaded from there and nowhere
+ * else. Otherwise it is looked up at the path baked in at build time, then
+ * by its bare name.
+ */
+typedef struct {
+    void *handle;
+
+    int (*client_init)(AocClient *client);
+    void (*client_free)(AocClient *client);
+    int (*get_input)(AocClient *client, int year, int day, int force, file_view *out_input);
+    int (*submit_prewarm)(AocClient *client, int year, int day);
+    int (*submit_answer)(AocClient *client, int year, int day, int level,
+                         const char *answer, AocSubmissionResult *out_result);
+    int (*submit_answer_when_allowed)(AocClient *client, int year, int day, int level,
+                                      const char *answer, AocSubmissionResult *out_result);
+    void (*submission_result_free)(AocSubmissionResult *res);
+} AocNet;
+
+/* Returns 0 on success; on failure *net is left zeroed. */
+int aoc_net_load(AocNet *net);
+void aoc_net_unload(AocNet *net);
+
+#endif // AOC_NET_H
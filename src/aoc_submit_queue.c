@@ -0,0 +1,157 @@
+#include "aoc_submit_queue.h"
+#include "util.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// The server reports whole seconds; add a little so we never arrive early
+// and burn a request on another "too recent".
+#define AOC_SUBMIT_SLACK_SEC 0.5
+// Used when a "too recent" reply names no wait time.
+#define AOC_SUBMIT_DEFAULT_WAIT_SEC 60
+// Open the connection this long before a scheduled submission.
+#define AOC_SUBMIT_PREWARM_LEAD_SEC 2.0
+#define AOC_SUBMIT_MAX_NETWORK_ATTEMPTS 3
+
+static void sleep_until(double t) {
+    for (;;) {
+        const double left = t - now_sec();
+        if (left <= 0) return;
+        struct timespec ts;
+        ts.tv_sec = (time_t)left;
+        ts.tv_nsec = (long)((left - (double)ts.tv_sec) * 1e9);
+        if (nanosleep(&ts, NULL) == 0) return;
+        if (errno != EINTR) return;
+    }
+}
+
+void aoc_submit_queue_init(AocSubmitQueue *q) {
+    if (!q) return;
+    memset(q, 0, sizeof(*q));
+}
+
+void aoc_submit_queue_free(AocSubmitQueue *q) {
+    if (!q) return;
+    for (size_t i = 0; i < q->len; i++) {
+        free(q->items[i].answer);
+        aoc_submission_result_free(&q->items[i].result);
+    }
+    free(q->items);
+    memset(q, 0, sizeof(*q));
+}
+
+int aoc_submit_queue_add(AocSubmitQueue *q, int year, int day, int level, const char *answer) {
+    if (!q || !answer) return -1;
+
+    if (q->len == q->cap) {
+        const size_t new_cap = q->cap ? q->cap * 2 : 8;
+        AocPendingSubmission *tmp = realloc(q->items, new_cap * sizeof(AocPendingSubmission));
+        if (!tmp) return -1;
+        q->items = tmp;
+        q->cap = new_cap;
+    }
+
+    AocPendingSubmission *sub = &q->items[q->len];
+    memset(sub, 0, sizeof(*sub));
+    sub->year = year;
+    sub->day = day;
+    sub->level = level;
+    sub->answer = str_dup(answer);
+    if (!sub->answer) return -1;
+
+    q->len++;
+    return 0;
+}
+
+static double earliest_start(const AocSubmitQueue *q, const AocPendingSubmission *sub) {
+    return sub->not_before > q->next_allowed ? sub->not_before : q->next_allowed;
+}
+
+/* Next pending answer by earliest permitted start; ties keep queue order. */
+static AocPendingSubmission *pick_next(AocSubmitQueue *q) {
+    AocPendingSubmission *best = NULL;
+    for (size_t i = 0; i < q->len; i++) {
+        AocPendingSubmission *sub = &q->items[i];
+        if (sub->done) continue;
+        if (!best || earliest_start(q, sub) < earliest_start(q, best)) {
+            best = sub;
+        }
+    }
+    return best;
+}
+
+static void finish(AocPendingSubmission *sub, AocSubmissionResult *res,
+                   aoc_submit_result_fn on_result, void *ctx) {
+    sub->result = *res;
+    sub->done = 1;
+    if (on_result) on_result(sub, ctx);
+}
+
+int aoc_submit_queue_run(AocClient *client, AocSubmitQueue *q,
+                         aoc_submit_result_fn on_result, void *ctx) {
+    if (!client || !q) return -1;
+
+    int failures = 0;
+    AocPendingSubmission *sub;
+    while ((sub = pick_next(q)) != NULL) {
+        const double start = earliest_start(q, sub);
+        if (start - now_sec() > AOC_SUBMIT_PREWARM_LEAD_SEC) {
+            sleep_until(start - AOC_SUBMIT_PREWARM_LEAD_SEC);
+            aoc_submit_prewarm(client, sub->year, sub->day);
+        }
+        sleep_until(start);
+
+        AocSubmissionResult res;
+        const int rc = aoc_submit_answer(client, sub->year, sub->day, sub->level, sub->answer, &res);
+        sub->attempts++;
+        const double now = now_sec();
+
+        if (rc != 0) {
+            res.status = AOC_SUBMISSION_ERROR;
+            if (sub->attempts >= AOC_SUBMIT_MAX_NETWORK_ATTEMPTS) {
+                failures++;
+                finish(sub, &res, on_result, ctx);
+            } else {
+                aoc_submission_result_free(&res);
+                sub->not_before = now + (double)(1 << sub->attempts);
+            }
+            continue;
+        }
+
+        if (res.status == AOC_SUBMISSION_TOO_RECENT) {
+            const int wait = res.wait_seconds > 0 ? res.wait_seconds : AOC_SUBMIT_DEFAULT_WAIT_SEC;
+            q->next_allowed = now + wait + AOC_SUBMIT_SLACK_SEC;
+            sub->not_before = q->next_allowed;
+            aoc_submission_result_free(&res);
+            continue;
+        }
+
+        if (res.wait_seconds > 0) {
+            // e.g. a wrong answer locks the account for a minute
+            q->next_allowed = now + res.wait_seconds + AOC_SUBMIT_SLACK_SEC;
+        }
+        finish(sub, &res, on_result, ctx);
+    }
+    return failures;
+}
+
+int aoc_submit_answer_when_allowed(AocClient *client, int year, int day, int level,
+                                   const char *answer, AocSubmissionResult *out_result) {
+    memset(out_result, 0, sizeof(*out_result));
+
+    AocSubmitQueue q;
+    aoc_submit_queue_init(&q);
+    if (aoc_submit_queue_add(&q, year, day, level, answer) != 0) {
+        aoc_submit_queue_free(&q);
+        return -1;
+    }
+
+    const int rc = aoc_submit_queue_run(client, &q, NULL, NULL);
+    *out_result = q.items[0].result;
+    memset(&q.items[0].result, 0, sizeof(q.items[0].result)); // moved out
+    aoc_submit_queue_free(&q);
+    return rc;
+}
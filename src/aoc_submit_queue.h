@@ -0,0 +1,60 @@
+#ifndef AOC_SUBMIT_QUEUE_H
+#define AOC_SUBMIT_QUEUE_H
+
+#include "aoc_client.h"
+
+#include <stddef.h>
+
+typedef struct {
+    int year;
+    int day;
+    int level;
+    char *answer;
+
+    double not_before;  // now_sec() timestamp, 0 = as soon as allowed
+    int attempts;
+    int done;
+    AocSubmissionResult result; // final result once done
+} AocPendingSubmission;
+
+/**
+ * Queue of answers waiting to be submitted.
+ *
+ * AoC rate-limits per account, not per puzzle, so the queue keeps a single
+ * next_allowed instant. It is moved forward whenever a response announces a
+ * cooldown ("Please wait one minute", "You have 4m 32s left to wait").
+ */
+typedef struct {
+    AocPendingSubmission *items;
+    size_t len;
+    size_t cap;
+    double next_allowed;
+} AocSubmitQueue;
+
+void aoc_submit_queue_init(AocSubmitQueue *q);
+void aoc_submit_queue_free(AocSubmitQueue *q);
+
+/* Copies answer. Returns 0 on success. */
+int aoc_submit_queue_add(AocSubmitQueue *q, int year, int day, int level, const char *answer);
+
+typedef void (*aoc_submit_result_fn)(const AocPendingSubmission *sub, void *ctx);
+
+/**
+ * Submit every queued answer, sleeping until the earliest permitted
+ * instant before each POST. Answers rejected as "too recent" are
+ * rescheduled for the announced time rather than retried blindly.
+ *
+ * on_result (may be NULL) is called once per answer with its final result.
+ * Returns 0 if every answer got a server response, non-zero otherwise.
+ */
+int aoc_submit_queue_run(AocClient *client, AocSubmitQueue *q,
+                         aoc_submit_result_fn on_result, void *ctx);
+
+/**
+ * Submit one answer through a single-entry queue, waiting out any cooldown
+ * the server announces. Same contract as aoc_submit_answer().
+ */
+int aoc_submit_answer_when_allowed(AocClient *client, int year, int day, int level,
+                                   const char *answer, AocSubmissionResult *out_result);
+
+#endif // AOC_SUBMIT_QUEUE_H
@@ -0,0 +1,129 @@
+/**
+ * Row-major vs tiled Grid on large generated grids.
+ *
+ *   grid_layout_bench [size] [seed]
+ *
+ * Builds a size x size grid with ~25% walls and times the same passes in
+ * both layouts: a BFS flood fill from the centre, a
+ * column-by-column sweep, and a 4-neighbour count over every cell in
+ * storage order. Only grid_index/grid_iterator differ between the runs.
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "containers/grid.h"
+#include "containers/point.h"
+#include "containers/ring.h"
+
+RING_DEFINE(point, Point)
+
+static double now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e3 + (double)ts.tv_nsec / 1e6;
+}
+
+static Grid* generate(int size, uint32_t seed) {
+    Grid* g = grid_new(size, size);
+    uint32_t x = seed;
+    for (size_t i = 0; i < (size_t)size * (size_t)size; i++) {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        g->cells[i] = x % 4 == 0 ? '#' : '.';
+    }
+    g->cells[grid_index(g, size / 2, size / 2)] = '.';
+    return g;
+}
+
+/* Cells reached from the centre; marks them 'o' in g. */
+static size_t flood_fill(Grid* g) {
+    const Point start = {g->width / 2, g->height / 2};
+    ring_point frontier;
+    ring_point_init(&frontier);
+    ring_point_push(&frontier, start);
+    g->cells[grid_index(g, start.x, start.y)] = 'o';
+
+    size_t reached = 0;
+    while (!ring_point_empty(&frontier)) {
+        const Point p = ring_point_pop(&frontier);
+        reached++;
+        for (int d = 0; d < 4; d++) {
+            const int nx = p.x + DIRS4[d].x;
+            const int ny = p.y + DIRS4[d].y;
+            if (nx < 0 || ny < 0 || nx >= g->width || ny >= g->height) continue;
+            char* cell = &g->cells[grid_index(g, nx, ny)];
+            if (*cell != '.') continue;
+            *cell = 'o';
+            ring_point_push(&frontier, (Point){nx, ny});
+        }
+    }
+    ring_point_free(&frontier);
+    return reached;
+}
+
+/* Walls directly above another wall, walking down the columns. */
+static size_t column_sweep(const Grid* g) {
+    size_t stacked = 0;
+    for (int x = 0; x < g->width; x++) {
+        for (int y = 1; y < g->height; y++) {
+            stacked += g->cells[grid_index(g, x, y)] == '#'
+                       && g->cells[grid_index(g, x, y - 1)] == '#';
+        }
+    }
+    return stacked;
+}
+
+/* Sum over all cells of their wall neighbours, visiting in storage order. */
+static size_t neighbour_pass(Grid* g) {
+    size_t total = 0;
+    grid_iter it = grid_iterator(g);
+    while (grid_next(&it)) {
+        for (int d = 0; d < 4; d++) {
+            const int nx = it.x + DIRS4[d].x;
+            const int ny = it.y + DIRS4[d].y;
+            if (nx < 0 || ny < 0 || nx >= g->width || ny >= g->height) continue;
+            total += g->cells[grid_index(g, nx, ny)] == '#';
+        }
+    }
+    return total;
+}
+
+static void run(const char* name, const Grid* source, GridLayout layout) {
+    Grid* g = grid_convert(source, layout);
+
+    double t = now_ms();
+    const size_t stacked = column_sweep(g);
+    const double sweep_ms = now_ms() - t;
+
+    t = now_ms();
+    const size_t walls = neighbour_pass(g);
+    const double pass_ms = now_ms() - t;
+
+    t = now_ms();
+    const size_t reached = flood_fill(g);
+    const double bfs_ms = now_ms() - t;
+
+    printf("%-10s  bfs %9.1f ms  columns %8.1f ms  neighbours %8.1f ms   (%zu / %zu / %zu)\n",
+           name, bfs_ms, sweep_ms, pass_ms, reached, stacked, walls);
+    grid_free(g);
+}
+
+int main(int argc, char** argv) {
+    const int size = argc > 1 ? atoi(argv[1]) : 4096;
+    const uint32_t seed = argc > 2 ? (uint32_t)strtoul(argv[2], NULL, 10) : 2463534242u;
+    if (size <= 1) {
+        fprintf(stderr, "usage: %s [size] [seed]\n", argv[0]);
+        return 1;
+    }
+
+    printf("%d x %d grid\n", size, size);
+    Grid* source = generate(size, seed);
+    run("row-major", source, GRID_ROW_MAJOR);
+    run("tiled", source, GRID_TILED);
+    grid_free(source);
+    return 0;
+}
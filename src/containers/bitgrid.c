@@ -0,0 +1,215 @@
+#include "containers/bitgrid.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+bitgrid* bitgrid_new(int width, int height) {
+    if (width <= 0 || height <= 0) return NULL;
+
+    bitgrid* b = malloc(sizeof(bitgrid));
+    if (!b) {
+        fprintf(stderr, "bitgrid_new: out of memory\n");
+        abort();
+    }
+    b->width = width;
+    b->height = height;
+    b->words = (width + 63) / 64;
+    b->stride = (size_t)b->words + 2;
+    b->alloc = calloc(b->stride * ((size_t)height + 2), sizeof(uint64_t));
+    if (!b->alloc) {
+        fprintf(stderr, "bitgrid_new: out of memory (rows)\n");
+        free(b);
+        abort();
+    }
+    b->rows = b->alloc + b->stride + 1;
+    return b;
+}
+
+bitgrid* bitgrid_from_grid(const Grid* g, char c) {
+    if (!g) return NULL;
+    bitgrid* b = bitgrid_new(g->width, g->height);
+    if (!b) return NULL;
+
+    for (int y = 0; y < g->height; y++) {
+        uint64_t* row = bitgrid_row(b, y);
+        for (int i = 0; i < b->words; i++) {
+            const int x0 = i * 64;
+            const int n = g->width - x0 < 64 ? g->width - x0 : 64;
+            // 64-wide spans never cross a tile, so either layout is contiguous here.
+            const char* cells = g->cells + grid_index(g, x0, y);
+            uint64_t w = 0;
+            for (int k = 0; k < n; k++) {
+                w |= (uint64_t)(cells[k] == c) << k;
+            }
+            row[i] = w;
+        }
+    }
+    return b;
+}
+
+void bitgrid_free(bitgrid* b) {
+    if (!b) return;
+    free(b->alloc);
+    free(b);
+}
+
+size_t bitgrid_count(const bitgrid* b) {
+    if (!b) return 0;
+    size_t total = 0;
+    for (int y = 0; y < b->height; y++) {
+        const uint64_t* row = bitgrid_row(b, y);
+        for (int i = 0; i < b->words; i++) total += (size_t)__builtin_popcountll(row[i]);
+    }
+    return total;
+}
+
+void bitgrid_and(bitgrid* dst, const bitgrid* src) {
+    for (int y = 0; y < dst->height; y++) {
+        uint64_t* d = bitgrid_row(dst, y);
+        const uint64_t* s = bitgrid_row(src, y);
+        for (int i = 0; i < dst->words; i++) d[i] &= s[i];
+    }
+}
+
+void bitgrid_and_not(bitgrid* dst, const bitgrid* src) {
+    for (int y = 0; y < dst->height; y++) {
+        uint64_t* d = bitgrid_row(dst, y);
+        const uint64_t* s = bitgrid_row(src, y);
+        for (int i = 0; i < dst->words; i++) d[i] &= ~s[i];
+    }
+}
+
+// ---- bit-sliced counting -----------------------------------------------------
+
+/* Neighbour to the west of each cell is the bit one lower, pulled across
+ * word boundaries from the word before (a zero word at the row start). */
+static inline uint64_t west(const uint64_t* r, int i) {
+    return (r[i] << 1) | (r[i - 1] >> 63);
+}
+
+static inline uint64_t east(const uint64_t* r, int i) {
+    return (r[i] >> 1) | (r[i + 1] << 63);
+}
+
+/* Full adder on 64 lanes: a + b + c = sum + 2 * carry. */
+static inline void add3(uint64_t a, uint64_t b, uint64_t c, uint64_t* sum, uint64_t* carry) {
+    const uint64_t t = a ^ b;
+    *sum = t ^ c;
+    *carry = (a & b) | (t & c);
+}
+
+/* Count of the 8 neighbours of each cell in word i of row y, as bit
+ * planes p[0] (ones) .. p[3] (eights). */
+static inline void count8(const bitgrid* b, int y, int i, uint64_t p[4]) {
+    const uint64_t* up = bitgrid_row(b, y - 1);
+    const uint64_t* mid = bitgrid_row(b, y);
+    const uint64_t* down = bitgrid_row(b, y + 1);
+
+    uint64_t s1, c1, s2, c2, s3, c3;
+    add3(west(up, i), up[i], east(up, i), &s1, &c1);
+    add3(west(mid, i), east(mid, i), west(down, i), &s2, &c2);
+    s3 = down[i] ^ east(down, i);
+    c3 = down[i] & east(down, i);
+
+    // Weight 1: three sums in, one bit out plus a carry of weight 2.
+    uint64_t ones, t1;
+    add3(s1, s2, s3, &ones, &t1);
+    // Weight 2: c1 + c2 + c3 + t1.
+    uint64_t u, v;
+    add3(c1, c2, c3, &u, &v);
+    const uint64_t twos = u ^ t1;
+    const uint64_t w = u & t1;
+    // Weight 4: v + w.
+    p[0] = ones;
+    p[1] = twos;
+    p[2] = v ^ w;
+    p[3] = v & w;
+}
+
+static inline void count4(const bitgrid* b, int y, int i, uint64_t p[4]) {
+    const uint64_t* mid = bitgrid_row(b, y);
+    const uint64_t n = bitgrid_row(b, y - 1)[i];
+    const uint64_t s = bitgrid_row(b, y + 1)[i];
+
+    uint64_t s1, c1;
+    add3(n, s, west(mid, i), &s1, &c1);
+    const uint64_t e = east(mid, i);
+    p[0] = s1 ^ e;
+    const uint64_t t = s1 & e;
+    p[1] = c1 ^ t;
+    p[2] = c1 & t;
+    p[3] = 0;
+}
+
+/* Lanes where the 4-bit count in p is below k. */
+static inline uint64_t less_than(const uint64_t p[4], int k) {
+    if (k > 15) return ~0ull;
+    uint64_t lt = 0, eq = ~0ull;
+    for (int j = 3; j >= 0; j--) {
+        if ((k >> j) & 1) {
+            lt |= eq & ~p[j];
+            eq &= p[j];
+        } else {
+            eq &= ~p[j];
+        }
+    }
+    return lt;
+}
+
+static inline uint64_t last_word_mask(const bitgrid* b, int i) {
+    const int bits = b->width - i * 64;
+    return bits >= 64 ? ~0ull : (1ull << bits) - 1;
+}
+
+static void unpack_counts(const bitgrid* b, int y, int i, const uint64_t p[4], uint8_t* counts) {
+    const int x0 = i * 64;
+    const int n = b->width - x0 < 64 ? b->width - x0 : 64;
+    uint8_t* out = counts + (size_t)y * (size_t)b->width + (size_t)x0;
+    for (int k = 0; k < n; k++) {
+        out[k] = (uint8_t)(((p[0] >> k) & 1) | (((p[1] >> k) & 1) << 1)
+                           | (((p[2] >> k) & 1) << 2) | (((p[3] >> k) & 1) << 3));
+    }
+}
+
+void bitgrid_neighbors8(const bitgrid* b, uint8_t* counts) {
+    for (int y = 0; y < b->height; y++) {
+        for (int i = 0; i < b->words; i++) {
+            uint64_t p[4];
+            count8(b, y, i, p);
+            unpack_counts(b, y, i, p, counts);
+        }
+    }
+}
+
+void bitgrid_neighbors4(const bitgrid* b, uint8_t* counts) {
+    for (int y = 0; y < b->height; y++) {
+        for (int i = 0; i < b->words; i++) {
+            uint64_t p[4];
+            count4(b, y, i, p);
+            unpack_counts(b, y, i, p, counts);
+        }
+    }
+}
+
+void bitgrid_fewer8(const bitgrid* b, int k, bitgrid* out) {
+    for (int y = 0; y < b->height; y++) {
+        uint64_t* o = bitgrid_row(out, y);
+        for (int i = 0; i < b->words; i++) {
+            uint64_t p[4];
+            count8(b, y, i, p);
+            o[i] = less_than(p, k) & last_word_mask(b, i);
+        }
+    }
+}
+
+void bitgrid_fewer4(const bitgrid* b, int k, bitgrid* out) {
+    for (int y = 0; y < b->height; y++) {
+        uint64_t* o = bitgrid_row(out, y);
+        for (int i = 0; i < b->words; i++) {
+            uint64_t p[4];
+            count4(b, y, i, p);
+            o[i] = less_than(p, k) & last_word_mask(b, i);
+        }
+    }
+}
@@ -0,0 +1,72 @@
+// bitgrid.h
+#ifndef BITGRID_H
+#define BITGRID_H
+
+/**
+ * One bit per cell: a single predicate over a grid ("is '@'"), 64 cells
+ * to a word, row-major.
+ *
+ * Neighbour counts are computed bit-sliced: for each word the eight (or
+ * four) shifted neighbour words go through a carry-save adder tree, giving
+ * the count for all 64 cells as four bit planes in a few dozen word ops,
+ * with no per-cell branches or bounds checks. The loop over words is
+ * plain uint64_t arithmetic, so the compiler is free to widen it further
+ * with SIMD.
+ *
+ * Every row has a zero word on either side and there is a zero row above
+ * and below the grid, and bits past width are always 0, so edge cells
+ * simply see empty neighbours.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "grid.h"
+
+typedef struct {
+    int width;
+    int height;
+    int words;        // words per row holding cells
+    size_t stride;    // words per row including the two zero words
+    uint64_t* rows;   // word 0 of row 0
+    uint64_t* alloc;
+} bitgrid;
+
+/* All cells clear. NULL if a dimension is not positive. */
+bitgrid* bitgrid_new(int width, int height);
+/* Cells of g equal to c. */
+bitgrid* bitgrid_from_grid(const Grid* g, char c);
+void bitgrid_free(bitgrid* b);
+
+static inline uint64_t* bitgrid_row(const bitgrid* b, int y) {
+    return b->rows + (size_t)y * b->stride;
+}
+
+/* Unchecked: 0 <= x < width, 0 <= y < height. */
+static inline bool bitgrid_get(const bitgrid* b, int x, int y) {
+    return (bitgrid_row(b, y)[x >> 6] >> (x & 63)) & 1;
+}
+
+static inline void bitgrid_set(bitgrid* b, int x, int y, bool on) {
+    uint64_t* w = &bitgrid_row(b, y)[x >> 6];
+    const uint64_t bit = 1ull << (x & 63);
+    *w = on ? (*w | bit) : (*w & ~bit);
+}
+
+size_t bitgrid_count(const bitgrid* b);
+
+/* dst &= src, dst &= ~src. Same dimensions. */
+void bitgrid_and(bitgrid* dst, const bitgrid* src);
+void bitgrid_and_not(bitgrid* dst, const bitgrid* src);
+
+/* counts[y * width + x] = set cells among the 8 (or 4) neighbours. */
+void bitgrid_neighbors8(const bitgrid* b, uint8_t* counts);
+void bitgrid_neighbors4(const bitgrid* b, uint8_t* counts);
+
+/* out = cells with fewer than k set neighbours, set or not. out has the
+ * dimensions of b and may not be b. */
+void bitgrid_fewer8(const bitgrid* b, int k, bitgrid* out);
+void bitgrid_fewer4(const bitgrid* b, int k, bitgrid* out);
+
+#endif
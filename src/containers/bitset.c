@@ -0,0 +1,180 @@
+#include "containers/bitset.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define BITSET_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define BITSET_SSE2 1
+#elif defined(__ARM_NEON) || defined(__aarch64__)
+#include <arm_neon.h>
+#define BITSET_NEON 1
+#endif
+
+bitset* bitset_new(size_t nbits) {
+    bitset* b = malloc(sizeof(bitset));
+    if (!b) {
+        fprintf(stderr, "bitset_new: out of memory\n");
+        abort();
+    }
+    b->nbits = nbits;
+    b->nwords = (nbits + 63) / 64;
+    b->words = calloc(b->nwords ? b->nwords : 1, sizeof(uint64_t));
+    if (!b->words) {
+        fprintf(stderr, "bitset_new: out of memory (words)\n");
+        free(b);
+        abort();
+    }
+    return b;
+}
+
+void bitset_free(bitset* b) {
+    if (!b) return;
+    free(b->words);
+    free(b);
+}
+
+/* Zero the bits past nbits in the last word. */
+static inline void trim(bitset* b) {
+    if (b->nbits & 63) b->words[b->nwords - 1] &= (1ull << (b->nbits & 63)) - 1;
+}
+
+void bitset_clear_all(bitset* b) {
+    memset(b->words, 0, b->nwords * sizeof(uint64_t));
+}
+
+void bitset_set_all(bitset* b) {
+    memset(b->words, 0xff, b->nwords * sizeof(uint64_t));
+    trim(b);
+}
+
+void bitset_copy(bitset* dst, const bitset* src) {
+    assert(dst->nbits == src->nbits);
+    memcpy(dst->words, src->words, src->nwords * sizeof(uint64_t));
+}
+
+size_t bitset_count(const bitset* b) {
+    size_t total = 0;
+    for (size_t i = 0; i < b->nwords; i++) total += (size_t)__builtin_popcountll(b->words[i]);
+    return total;
+}
+
+bool bitset_any(const bitset* b) {
+    for (size_t i = 0; i < b->nwords; i++) {
+        if (b->words[i]) return true;
+    }
+    return false;
+}
+
+size_t bitset_next_set(const bitset* b, size_t from) {
+    if (from >= b->nbits) return SIZE_MAX;
+    size_t i = from >> 6;
+    uint64_t w = b->words[i] & (~0ull << (from & 63));
+    while (!w) {
+        if (++i == b->nwords) return SIZE_MAX;
+        w = b->words[i];
+    }
+    return i * 64 + (size_t)__builtin_ctzll(w);
+}
+
+void bitset_shl(bitset* b, size_t k) {
+    if (k >= b->nbits) {
+        bitset_clear_all(b);
+        return;
+    }
+    const size_t ws = k >> 6;
+    const unsigned bs = (unsigned)(k & 63);
+    uint64_t* w = b->words;
+    // High to low, so every source word is read before it is overwritten.
+    for (size_t i = b->nwords; i-- > ws;) {
+        uint64_t v = w[i - ws] << bs;
+        if (bs && i > ws) v |= w[i - ws - 1] >> (64 - bs);
+        w[i] = v;
+    }
+    memset(w, 0, ws * sizeof(uint64_t));
+    trim(b);
+}
+
+void bitset_shr(bitset* b, size_t k) {
+    if (k >= b->nbits) {
+        bitset_clear_all(b);
+        return;
+    }
+    const size_t ws = k >> 6;
+    const unsigned bs = (unsigned)(k & 63);
+    uint64_t* w = b->words;
+    const size_t keep = b->nwords - ws;
+    for (size_t i = 0; i < keep; i++) {
+        uint64_t v = w[i + ws] >> bs;
+        if (bs && i + ws + 1 < b->nwords) v |= w[i + ws + 1] << (64 - bs);
+        w[i] = v;
+    }
+    memset(w + keep, 0, ws * sizeof(uint64_t));
+}
+
+// ---- bulk binary operations ----------------------------------------------------
+
+/* One loop per operation: a vector body, then a scalar tail. OP is the
+ * scalar expression; VEC the matching intrinsic. */
+#if defined(BITSET_AVX2)
+#define BITSET_LANES 4
+#define BITSET_VEC_LOOP(d, s, n, i, VEC)                                               \
+    for (; i + BITSET_LANES <= n; i += BITSET_LANES) {                                 \
+        const __m256i x = _mm256_loadu_si256((const __m256i*)(d + i));                 \
+        const __m256i y = _mm256_loadu_si256((const __m256i*)(s + i));                 \
+        _mm256_storeu_si256((__m256i*)(d + i), VEC##_avx2(x, y));                      \
+    }
+#define and_avx2(x, y) _mm256_and_si256(x, y)
+#define or_avx2(x, y) _mm256_or_si256(x, y)
+#define xor_avx2(x, y) _mm256_xor_si256(x, y)
+#define and_not_avx2(x, y) _mm256_andnot_si256(y, x)
+#elif defined(BITSET_SSE2)
+#define BITSET_LANES 2
+#define BITSET_VEC_LOOP(d, s, n, i, VEC)                                               \
+    for (; i + BITSET_LANES <= n; i += BITSET_LANES) {                                 \
+        const __m128i x = _mm_loadu_si128((const __m128i*)(d + i));                    \
+        const __m128i y = _mm_loadu_si128((const __m128i*)(s + i));                    \
+        _mm_storeu_si128((__m128i*)(d + i), VEC##_sse2(x, y));                         \
+    }
+#define and_sse2(x, y) _mm_and_si128(x, y)
+#define or_sse2(x, y) _mm_or_si128(x, y)
+#define xor_sse2(x, y) _mm_xor_si128(x, y)
+#define and_not_sse2(x, y) _mm_andnot_si128(y, x)
+#elif defined(BITSET_NEON)
+#define BITSET_LANES 2
+#define BITSET_VEC_LOOP(d, s, n, i, VEC)                                               \
+    for (; i + BITSET_LANES <= n; i += BITSET_LANES) {                                 \
+        vst1q_u64(d + i, VEC##_neon(vld1q_u64(d + i), vld1q_u64(s + i)));              \
+    }
+#define and_neon(x, y) vandq_u64(x, y)
+#define or_neon(x, y) vorrq_u64(x, y)
+#define xor_neon(x, y) veorq_u64(x, y)
+#define and_not_neon(x, y) vbicq_u64(x, y)
+#else
+#define BITSET_VEC_LOOP(d, s, n, i, VEC)
+#endif
+
+#define BITSET_BINARY(name, OP)                                                        \
+    void bitset_##name(bitset* dst, const bitset* src) {                               \
+        assert(dst->nbits == src->nbits);                                              \
+        uint64_t* d = dst->words;                                                      \
+        const uint64_t* s = src->words;                                                \
+        const size_t n = dst->nwords;                                                  \
+        size_t i = 0;                                                                  \
+        BITSET_VEC_LOOP(d, s, n, i, name)                                              \
+        for (; i < n; i++) d[i] = OP(d[i], s[i]);                                      \
+    }
+
+#define BITSET_AND(a, b) ((a) & (b))
+#define BITSET_OR(a, b) ((a) | (b))
+#define BITSET_XOR(a, b) ((a) ^ (b))
+#define BITSET_AND_NOT(a, b) ((a) & ~(b))
+
+BITSET_BINARY(and, BITSET_AND)
+BITSET_BINARY(or, BITSET_OR)
+BITSET_BINARY(xor, BITSET_XOR)
+BITSET_BINARY(and_not, BITSET_AND_NOT)
@@ -0,0 +1,74 @@
+// bitset.h
+#ifndef BITSET_H
+#define BITSET_H
+
+/**
+ * Fixed-size set of bits 0..nbits-1, packed 64 to a word.
+ *
+ * Single-bit access is inline. Whole-set operations go a word at a time,
+ * and the binary ones (and/or/xor/and_not) several words at a time with
+ * SSE2, AVX2 or NEON where the target has them. Bits past nbits in the
+ * last word are kept zero, so counts and shifts never see them.
+ *
+ * Binary operations and copy need both sets to be the same size.
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct {
+    size_t nbits;
+    size_t nwords;
+    uint64_t* words;
+} bitset;
+
+/* All bits clear. */
+bitset* bitset_new(size_t nbits);
+void bitset_free(bitset* b);
+
+static inline bool bitset_test(const bitset* b, size_t i) {
+    assert(i < b->nbits);
+    return (b->words[i >> 6] >> (i & 63)) & 1;
+}
+
+static inline void bitset_set(bitset* b, size_t i) {
+    assert(i < b->nbits);
+    b->words[i >> 6] |= 1ull << (i & 63);
+}
+
+static inline void bitset_clear(bitset* b, size_t i) {
+    assert(i < b->nbits);
+    b->words[i >> 6] &= ~(1ull << (i & 63));
+}
+
+static inline void bitset_assign(bitset* b, size_t i, bool value) {
+    assert(i < b->nbits);
+    const uint64_t bit = 1ull << (i & 63);
+    b->words[i >> 6] = (b->words[i >> 6] & ~bit) | (value ? bit : 0);
+}
+
+void bitset_clear_all(bitset* b);
+void bitset_set_all(bitset* b);
+void bitset_copy(bitset* dst, const bitset* src);
+
+/* Number of set bits. */
+size_t bitset_count(const bitset* b);
+bool bitset_any(const bitset* b);
+
+/* First set bit at or after from, or SIZE_MAX. */
+size_t bitset_next_set(const bitset* b, size_t from);
+
+/* Move every bit k places up (shl) or down (shr); bits shifted past
+ * either end are dropped. */
+void bitset_shl(bitset* b, size_t k);
+void bitset_shr(bitset* b, size_t k);
+
+/* dst = dst op src. */
+void bitset_and(bitset* dst, const bitset* src);
+void bitset_or(bitset* dst, const bitset* src);
+void bitset_xor(bitset* dst, const bitset* src);
+void bitset_and_not(bitset* dst, const bitset* src);
+
+#endif
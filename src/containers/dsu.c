@@ -0,0 +1,169 @@
+#include "containers/dsu.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static void* dsu_alloc(size_t size, const char* who) {
+    void* p = malloc(size);
+    if (!p) {
+        fprintf(stderr, "%s: out of memory\n", who);
+        abort();
+    }
+    return p;
+}
+
+dsu* dsu_new(size_t n) {
+    assert(n < UINT32_MAX);
+    dsu* d = dsu_alloc(sizeof(dsu), "dsu_new");
+    d->n = (uint32_t)n;
+    d->parent = dsu_alloc((n ? n : 1) * sizeof(uint32_t), "dsu_new");
+    d->size = dsu_alloc((n ? n : 1) * sizeof(uint32_t), "dsu_new");
+    dsu_reset(d);
+    return d;
+}
+
+void dsu_free(dsu* d) {
+    if (!d) return;
+    free(d->parent);
+    free(d->size);
+    free(d);
+}
+
+void dsu_reset(dsu* d) {
+    for (uint32_t i = 0; i < d->n; i++) {
+        d->parent[i] = i;
+        d->size[i] = 1;
+    }
+    d->components = d->n;
+}
+
+bool dsu_union(dsu* d, uint32_t a, uint32_t b) {
+    a = dsu_find(d, a);
+    b = dsu_find(d, b);
+    if (a == b) return false;
+    if (d->size[a] < d->size[b]) {
+        const uint32_t t = a;
+        a = b;
+        b = t;
+    }
+    d->parent[b] = a;
+    d->size[a] += d->size[b];
+    d->components--;
+    return true;
+}
+
+/* Keep the k largest of a stream of sizes in out[0..*len), descending.
+ * k is small in practice, so insertion beats a heap. */
+static void top_insert(size_t* out, size_t* len, size_t k, size_t s) {
+    size_t i = *len;
+    if (i == k) {
+        if (k == 0 || s <= out[k - 1]) return;
+        i--;
+    } else {
+        ++*len;
+    }
+    while (i > 0 && out[i - 1] < s) {
+        out[i] = out[i - 1];
+        i--;
+    }
+    out[i] = s;
+}
+
+size_t dsu_top_sizes(const dsu* d, size_t k, size_t* out) {
+    size_t len = 0;
+    for (uint32_t i = 0; i < d->n; i++) {
+        if (d->parent[i] == i) top_insert(out, &len, k, d->size[i]);
+    }
+    return len;
+}
+
+// ---- concurrent ----------------------------------------------------------------
+
+dsu_atomic* dsu_atomic_new(size_t n) {
+    assert(n < UINT32_MAX);
+    dsu_atomic* d = dsu_alloc(sizeof(dsu_atomic), "dsu_atomic_new");
+    d->n = (uint32_t)n;
+    d->parent = dsu_alloc((n ? n : 1) * sizeof(_Atomic uint32_t), "dsu_atomic_new");
+    dsu_atomic_reset(d);
+    return d;
+}
+
+void dsu_atomic_free(dsu_atomic* d) {
+    if (!d) return;
+    free(d->parent);
+    free(d);
+}
+
+void dsu_atomic_reset(dsu_atomic* d) {
+    for (uint32_t i = 0; i < d->n; i++) atomic_init(&d->parent[i], i);
+}
+
+/* Path halving with CAS: a failed CAS means someone else already moved
+ * that node closer to the root, which is just as good. Parents only ever
+ * point at lower indices, so the walk always terminates. */
+uint32_t dsu_atomic_find(dsu_atomic* d, uint32_t x) {
+    for (;;) {
+        uint32_t p = atomic_load_explicit(&d->parent[x], memory_order_acquire);
+        if (p == x) return x;
+        const uint32_t gp = atomic_load_explicit(&d->parent[p], memory_order_acquire);
+        if (gp != p) {
+            atomic_compare_exchange_weak_explicit(&d->parent[x], &p, gp,
+                                                  memory_order_release, memory_order_relaxed);
+        }
+        x = gp;
+    }
+}
+
+bool dsu_atomic_union(dsu_atomic* d, uint32_t a, uint32_t b) {
+    for (;;) {
+        a = dsu_atomic_find(d, a);
+        b = dsu_atomic_find(d, b);
+        if (a == b) return false;
+        if (a > b) {
+            const uint32_t t = a;
+            a = b;
+            b = t;
+        }
+        // b is a root only as long as nobody links it first.
+        uint32_t expected = b;
+        if (atomic_compare_exchange_strong_explicit(&d->parent[b], &expected, a,
+                                                    memory_order_acq_rel, memory_order_relaxed)) {
+            return true;
+        }
+    }
+}
+
+bool dsu_atomic_same(dsu_atomic* d, uint32_t a, uint32_t b) {
+    for (;;) {
+        a = dsu_atomic_find(d, a);
+        b = dsu_atomic_find(d, b);
+        if (a == b) return true;
+        // a may have been linked under something since we found it.
+        if (atomic_load_explicit(&d->parent[a], memory_order_acquire) == a) return false;
+    }
+}
+
+size_t dsu_atomic_components(dsu_atomic* d) {
+    size_t roots = 0;
+    for (uint32_t i = 0; i < d->n; i++) {
+        roots += atomic_load_explicit(&d->parent[i], memory_order_relaxed) == i;
+    }
+    return roots;
+}
+
+size_t dsu_atomic_top_sizes(dsu_atomic* d, size_t k, size_t* out) {
+    uint32_t* size = calloc(d->n ? d->n : 1, sizeof(uint32_t));
+    if (!size) {
+        fprintf(stderr, "dsu_atomic_top_sizes: out of memory\n");
+        abort();
+    }
+    for (uint32_t i = 0; i < d->n; i++) size[dsu_atomic_find(d, i)]++;
+
+    size_t len = 0;
+    for (uint32_t i = 0; i < d->n; i++) {
+        if (size[i]) top_insert(out, &len, k, size[i]);
+    }
+    free(size);
+    return len;
+}
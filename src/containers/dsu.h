@@ -0,0 +1,91 @@
+// dsu.h
+#ifndef DSU_H
+#define DSU_H
+
+/**
+ * Disjoint-set forests (union-find) over elements 0..n-1.
+ *
+ * dsu is the single-threaded one: union by size, and find halves the path
+ * as it walks (every node is pointed at its grandparent), iteratively, so
+ * even the first find on a long chain uses no stack.
+ *
+ * dsu_atomic may be united and queried from many threads at once. Parents
+ * are atomics and a union links one root under the other with a single
+ * CAS, retrying if another thread got there first. Roots are linked by
+ * index (the larger under the smaller) rather than by size, since size
+ * and parent can't be updated together in one CAS; component sizes are
+ * counted afterwards.
+ */
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct {
+    uint32_t n;
+    uint32_t components;
+    uint32_t* parent;
+    uint32_t* size;      // valid at roots only
+} dsu;
+
+dsu* dsu_new(size_t n);
+void dsu_free(dsu* d);
+
+/* Every element back in a set of its own. */
+void dsu_reset(dsu* d);
+
+static inline uint32_t dsu_find(dsu* d, uint32_t x) {
+    uint32_t* parent = d->parent;
+    while (parent[x] != x) {
+        parent[x] = parent[parent[x]];
+        x = parent[x];
+    }
+    return x;
+}
+
+/* Merge the sets of a and b. False if they were already one set. */
+bool dsu_union(dsu* d, uint32_t a, uint32_t b);
+
+static inline bool dsu_same(dsu* d, uint32_t a, uint32_t b) {
+    return dsu_find(d, a) == dsu_find(d, b);
+}
+
+/* Size of the set containing x. */
+static inline size_t dsu_size(dsu* d, uint32_t x) {
+    return d->size[dsu_find(d, x)];
+}
+
+static inline size_t dsu_components(const dsu* d) {
+    return d->components;
+}
+
+/**
+ * The k largest set sizes, largest first, in out. Returns how many were
+ * written: k, or the number of sets if that is smaller.
+ */
+size_t dsu_top_sizes(const dsu* d, size_t k, size_t* out);
+
+// ---- concurrent ----------------------------------------------------------------
+
+typedef struct {
+    uint32_t n;
+    _Atomic uint32_t* parent;
+} dsu_atomic;
+
+dsu_atomic* dsu_atomic_new(size_t n);
+void dsu_atomic_free(dsu_atomic* d);
+
+/* Not thread-safe: call while no other thread is using d. */
+void dsu_atomic_reset(dsu_atomic* d);
+
+uint32_t dsu_atomic_find(dsu_atomic* d, uint32_t x);
+bool dsu_atomic_union(dsu_atomic* d, uint32_t a, uint32_t b);
+bool dsu_atomic_same(dsu_atomic* d, uint32_t a, uint32_t b);
+
+/* Counting functions walk every element; call them once the unions are
+ * done. */
+size_t dsu_atomic_components(dsu_atomic* d);
+size_t dsu_atomic_top_sizes(dsu_atomic* d, size_t k, size_t* out);
+
+#endif
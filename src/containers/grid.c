@@ -5,6 +5,10 @@
 #include <stdio.h>
 
 Grid* grid_new(int width, int height) {
+    return grid_new_layout(width, height, GRID_ROW_MAJOR);
+}
+
+Grid* grid_new_layout(int width, int height, GridLayout layout) {
     if (width <= 0 || height <= 0) {
         return NULL;
     }
@@ -17,14 +21,23 @@ Grid* grid_new(int width, int height) {
 
     g->width = width;
     g->height = height;
-    g->cells = malloc((size_t)width * (size_t)height * sizeof(char));
+    g->layout = layout;
+    g->tiles_x = (width + GRID_TILE - 1) / GRID_TILE;
+
+    size_t size = (size_t)width * (size_t)height;
+    if (layout == GRID_TILED) {
+        // Whole tiles, edge tiles padded.
+        const size_t tiles_y = ((size_t)height + GRID_TILE - 1) / GRID_TILE;
+        size = (size_t)g->tiles_x * tiles_y * GRID_TILE * GRID_TILE;
+    }
+    g->cells = malloc(size * sizeof(char));
     if (!g->cells) {
         fprintf(stderr, "grid_new: out of memory (cells)\n");
         free(g);
         abort();
     }
 
-    memset(g->cells, 0, (size_t)width * (size_t)height);
+    memset(g->cells, 0, size);
     return g;
 }
 
@@ -42,15 +55,34 @@ bool grid_in_bounds(Grid* g, int x, int y) {
 char grid_get(Grid* g, int x, int y) {
     if (!g) return 0;
     if (!grid_in_bounds(g, x, y)) return 0;
-    const size_t idx = (size_t)y * (size_t)g->width + (size_t)x;
-    return g->cells[idx];
+    return g->cells[grid_index(g, x, y)];
 }
 
 void grid_set(Grid* g, int x, int y, char value) {
     if (!g) return;
     if (!grid_in_bounds(g, x, y)) return;
-    const size_t idx = (size_t)y * (size_t)g->width + (size_t)x;
-    g->cells[idx] = value;
+    g->cells[grid_index(g, x, y)] = value;
+}
+
+Grid* grid_convert(const Grid* src, GridLayout layout) {
+    if (!src) return NULL;
+    Grid* g = grid_new_layout(src->width, src->height, layout);
+    if (!g) return NULL;
+
+    if (layout == src->layout) {
+        const size_t tiles_y = ((size_t)src->height + GRID_TILE - 1) / GRID_TILE;
+        const size_t size = layout == GRID_TILED
+            ? (size_t)src->tiles_x * tiles_y * GRID_TILE * GRID_TILE
+            : (size_t)src->width * (size_t)src->height;
+        memcpy(g->cells, src->cells, size);
+        return g;
+    }
+    for (int y = 0; y < src->height; y++) {
+        for (int x = 0; x < src->width; x++) {
+            g->cells[grid_index(g, x, y)] = src->cells[grid_index(src, x, y)];
+        }
+    }
+    return g;
 }
 
 Grid* grid_from_string(const char* input) {
@@ -111,3 +143,50 @@ Grid* grid_from_string(const char* input) {
 
     return g;
 }
+
+grid_iter grid_iterator(Grid* g) {
+    grid_iter it;
+    memset(&it, 0, sizeof(it));
+    it._grid = g;
+    if (g) {
+        const bool tiled = g->layout == GRID_TILED;
+        it._x1 = tiled && g->width > GRID_TILE ? GRID_TILE : g->width;
+        it._y1 = tiled && g->height > GRID_TILE ? GRID_TILE : g->height;
+    }
+    return it;
+}
+
+bool grid_next(grid_iter* it) {
+    Grid* g = it->_grid;
+    if (!g) return false;
+
+    if (!it->_started) {
+        it->_started = true;
+        it->x = it->_x0;
+        it->y = it->_y0;
+    } else if (++it->x >= it->_x1) {
+        it->x = it->_x0;
+        if (++it->y >= it->_y1) {
+            // Row-major is a single tile covering the grid.
+            if (g->layout != GRID_TILED) {
+                it->_grid = NULL;
+                return false;
+            }
+            it->_x0 += GRID_TILE;
+            if (it->_x0 >= g->width) {
+                it->_x0 = 0;
+                it->_y0 += GRID_TILE;
+                if (it->_y0 >= g->height) {
+                    it->_grid = NULL;
+                    return false;
+                }
+            }
+            it->_x1 = it->_x0 + GRID_TILE < g->width ? it->_x0 + GRID_TILE : g->width;
+            it->_y1 = it->_y0 + GRID_TILE < g->height ? it->_y0 + GRID_TILE : g->height;
+            it->x = it->_x0;
+            it->y = it->_y0;
+        }
+    }
+    it->cell = g->cells + grid_index(g, it->x, it->y);
+    return true;
+}
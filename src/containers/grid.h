@@ -5,15 +5,40 @@
 #include <stddef.h>
 #include <stdbool.h>
 
+/**
+ * How cells are laid out in memory. Row-major is the default and the
+ * only layout where `cells` can be indexed as y * width + x directly.
+ *
+ * GRID_TILED stores 64x64 tiles (4 KiB, one page) back to back, row-major
+ * inside each tile. A vertical step then stays within the same page, so
+ * BFS and peeling passes over very large grids stop missing the TLB on
+ * every row change. Go through grid_get/grid_set/grid_index, or visit
+ * cells in storage order with grid_iterator.
+ */
+typedef enum {
+    GRID_ROW_MAJOR,
+    GRID_TILED
+} GridLayout;
+
+#define GRID_TILE_SHIFT 6
+#define GRID_TILE (1 << GRID_TILE_SHIFT)
+#define GRID_TILE_MASK (GRID_TILE - 1)
+
 typedef struct {
     int width;
     int height;
     char *cells;
+    GridLayout layout;
+    int tiles_x;  // tiles per row of tiles (GRID_TILED)
 } Grid;
 
 Grid* grid_new(int width, int height);
+Grid* grid_new_layout(int width, int height, GridLayout layout);
 void grid_free(Grid* g);
 
+/* A copy of g in the given layout. */
+Grid* grid_convert(const Grid* g, GridLayout layout);
+
 bool grid_in_bounds(Grid* g, int x, int y);
 
 char grid_get(Grid* g, int x, int y);
@@ -21,4 +46,36 @@ void grid_set(Grid* g, int x, int y, char value);
 
 Grid* grid_from_string(const char* input);
 
+/* Offset of (x, y) in cells for g's layout. Unchecked. */
+static inline size_t grid_index(const Grid* g, int x, int y) {
+    if (g->layout == GRID_TILED) {
+        const size_t tile = (size_t)(y >> GRID_TILE_SHIFT) * (size_t)g->tiles_x
+                            + (size_t)(x >> GRID_TILE_SHIFT);
+        return (tile << (2 * GRID_TILE_SHIFT))
+               | ((size_t)(y & GRID_TILE_MASK) << GRID_TILE_SHIFT)
+               | (size_t)(x & GRID_TILE_MASK);
+    }
+    return (size_t)y * (size_t)g->width + (size_t)x;
+}
+
+/**
+ * Every cell once, in storage order: row by row, or tile by tile.
+ *
+ *   grid_iter it = grid_iterator(g);
+ *   while (grid_next(&it)) { ... it.x, it.y, *it.cell ... }
+ */
+typedef struct {
+    int x;
+    int y;
+    char* cell;
+    // private
+    Grid* _grid;
+    int _x0, _y0;  // current tile origin
+    int _x1, _y1;  // current tile end (exclusive)
+    bool _started;
+} grid_iter;
+
+grid_iter grid_iterator(Grid* g);
+bool grid_next(grid_iter* it);
+
 #endif
@@ -0,0 +1,112 @@
+#include "containers/grid_bfs.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static void* bfs_alloc(size_t size) {
+    void* p = malloc(size);
+    if (!p) {
+        fprintf(stderr, "grid_bfs_init: out of memory\n");
+        abort();
+    }
+    return p;
+}
+
+void grid_bfs_init(grid_bfs* b, const padgrid* g, const char* blocked, int flags) {
+    assert(g && g->border >= 1);
+    assert((size_t)g->height * (size_t)g->stride <= INT32_MAX);
+
+    b->grid = g;
+    memset(b->blocked, 0, sizeof(b->blocked));
+    for (const char* c = blocked; c && *c; c++) b->blocked[(unsigned char)*c] = true;
+    b->blocked[(unsigned char)g->sentinel] = true;
+
+    b->cells = (size_t)g->height * (size_t)g->stride;
+    b->visited = bfs_alloc((b->cells + 63) / 64 * sizeof(uint64_t));
+    b->dist = (flags & GRID_BFS_DIST) ? bfs_alloc(b->cells * sizeof(int32_t)) : NULL;
+    b->parent = (flags & GRID_BFS_PATH) ? bfs_alloc(b->cells * sizeof(int32_t)) : NULL;
+    ring_int32_init(&b->frontier);
+    ring_int32_reserve(&b->frontier, 2 * ((size_t)g->width + (size_t)g->height));
+    grid_bfs_reset(b);
+}
+
+void grid_bfs_free(grid_bfs* b) {
+    if (!b) return;
+    free(b->visited);
+    free(b->dist);
+    free(b->parent);
+    ring_int32_free(&b->frontier);
+    b->visited = NULL;
+    b->dist = NULL;
+    b->parent = NULL;
+}
+
+void grid_bfs_reset(grid_bfs* b) {
+    memset(b->visited, 0, (b->cells + 63) / 64 * sizeof(uint64_t));
+    if (b->dist) memset(b->dist, 0xff, b->cells * sizeof(int32_t));
+    ring_int32_clear(&b->frontier);
+}
+
+static inline void mark(grid_bfs* b, int32_t i, int32_t from, int32_t dist) {
+    b->visited[(uint32_t)i >> 6] |= 1ull << ((uint32_t)i & 63);
+    if (b->dist) b->dist[i] = dist;
+    if (b->parent) b->parent[i] = from;
+}
+
+int grid_bfs_run(grid_bfs* b, const ptrdiff_t* sources, size_t n_sources, ptrdiff_t goal) {
+    const char* cells = b->grid->cells;
+    const ptrdiff_t* dirs = b->grid->dirs4;
+
+    for (size_t s = 0; s < n_sources; s++) {
+        const int32_t i = (int32_t)sources[s];
+        if (b->blocked[(unsigned char)cells[i]] || grid_bfs_visited(b, i)) continue;
+        mark(b, i, -1, 0);
+        if (i == goal) {
+            ring_int32_clear(&b->frontier);
+            return 0;
+        }
+        ring_int32_push(&b->frontier, i);
+    }
+
+    int farthest = -1;
+    for (int32_t level = 0; !ring_int32_empty(&b->frontier); level++) {
+        farthest = level;
+        for (size_t left = ring_int32_len(&b->frontier); left > 0; left--) {
+            const int32_t i = ring_int32_pop(&b->frontier);
+            for (int d = 0; d < 4; d++) {
+                const int32_t n = i + (int32_t)dirs[d];
+                if (b->blocked[(unsigned char)cells[n]] || grid_bfs_visited(b, n)) continue;
+                mark(b, n, i, level + 1);
+                if (n == goal) {
+                    ring_int32_clear(&b->frontier);
+                    return level + 1;
+                }
+                ring_int32_push(&b->frontier, n);
+            }
+        }
+    }
+    return goal < 0 ? farthest : -1;
+}
+
+size_t grid_bfs_count(const grid_bfs* b) {
+    size_t total = 0;
+    for (size_t w = 0; w < (b->cells + 63) / 64; w++) {
+        total += (size_t)__builtin_popcountll(b->visited[w]);
+    }
+    return total;
+}
+
+size_t grid_bfs_path(const grid_bfs* b, ptrdiff_t goal, ptrdiff_t* out, size_t cap) {
+    assert(b->parent);
+    if (goal < 0 || (size_t)goal >= b->cells || !grid_bfs_visited(b, goal)) return 0;
+
+    size_t len = 0;
+    for (int32_t i = (int32_t)goal; i >= 0; i = b->parent[i]) len++;
+    if (len > cap) return len;
+
+    size_t k = len;
+    for (int32_t i = (int32_t)goal; i >= 0; i = b->parent[i]) out[--k] = i;
+    return len;
+}
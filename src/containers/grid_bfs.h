@@ -0,0 +1,82 @@
+// grid_bfs.h
+#ifndef GRID_BFS_H
+#define GRID_BFS_H
+
+/**
+ * Breadth-first search over a padgrid's cell indices, single- or
+ * multi-source, 4-neighbour.
+ *
+ * All state is allocated once at init: a visited bitset (one bit per
+ * cell), an int32 ring of cell indices for the frontier, and optionally
+ * per-cell distances and parents. Runs go level by level, so the goal
+ * distance is known without a distance array; reset() clears the
+ * state for another run on the same grid.
+ *
+ *   grid_bfs bfs;
+ *   grid_bfs_init(&bfs, g, "#", GRID_BFS_PATH);
+ *   const int d = grid_bfs_run(&bfs, &start, 1, goal);
+ *   ptrdiff_t path[...];
+ *   grid_bfs_path(&bfs, goal, path, cap);
+ *   grid_bfs_free(&bfs);
+ *
+ * Cells whose char is in `blocked` are never entered; the padgrid's
+ * sentinel always counts as blocked, so the border needs no checks.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "padgrid.h"
+#include "ring.h"
+
+enum {
+    GRID_BFS_DIST = 1,  // keep per-cell distances
+    GRID_BFS_PATH = 2,  // keep parents, for grid_bfs_path
+};
+
+typedef struct {
+    const padgrid* grid;
+    bool blocked[256];
+    size_t cells;        // index space: height * stride
+    uint64_t* visited;
+    int32_t* dist;       // NULL without GRID_BFS_DIST
+    int32_t* parent;     // NULL without GRID_BFS_PATH
+    ring_int32 frontier;
+} grid_bfs;
+
+void grid_bfs_init(grid_bfs* b, const padgrid* g, const char* blocked, int flags);
+void grid_bfs_free(grid_bfs* b);
+
+/* Forget the previous run. */
+void grid_bfs_reset(grid_bfs* b);
+
+/**
+ * Search outward from every source at once until goal is reached (goal
+ * -1: until everything reachable is visited). Returns the distance to
+ * goal, or -1 if it was not reached; with goal -1, the largest distance
+ * seen. Blocked sources are skipped.
+ */
+int grid_bfs_run(grid_bfs* b, const ptrdiff_t* sources, size_t n_sources, ptrdiff_t goal);
+
+static inline bool grid_bfs_visited(const grid_bfs* b, ptrdiff_t i) {
+    return (b->visited[(size_t)i >> 6] >> ((size_t)i & 63)) & 1;
+}
+
+/* Distance of cell i from the nearest source, -1 if unreached. Needs
+ * GRID_BFS_DIST. */
+static inline int32_t grid_bfs_dist(const grid_bfs* b, ptrdiff_t i) {
+    return b->dist[i];
+}
+
+/* Cells visited by the last run. */
+size_t grid_bfs_count(const grid_bfs* b);
+
+/**
+ * Shortest path from a source to goal, source first, written to out if it
+ * fits in cap. Returns the number of cells on the path (0 if goal was not
+ * reached). Needs GRID_BFS_PATH.
+ */
+size_t grid_bfs_path(const grid_bfs* b, ptrdiff_t goal, ptrdiff_t* out, size_t cap);
+
+#endif
@@ -3,40 +3,75 @@
 #include <string.h>
 #include <stdint.h>
 #include <assert.h>
+#include "swiss.h"
 
 typedef struct {
     const char* key;
     void* value;
 } hm_entry;
 
+/*
+ * SwissTable layout: ctrl[i] tags entries[i] (see swiss.h). Capacity is a
+ * power of two and a multiple of the group width; hm never deletes, so
+ * there are no DELETED tags.
+ */
 struct hm {
     hm_entry* entries;
+    int8_t* ctrl;
     size_t capacity;
     size_t length;
+    intern_pool* pool; // owns the keys when set
 };
 
 #define INITIAL_CAPACITY 16
 
+static bool hm_alloc(hm* map, size_t capacity) {
+    hm_entry* entries = malloc(capacity * sizeof(hm_entry));
+    int8_t* ctrl = malloc(capacity);
+    if (entries == NULL || ctrl == NULL) {
+        free(entries);
+        free(ctrl);
+        return false;
+    }
+    swiss_ctrl_reset(ctrl, capacity / SWISS_GROUP_WIDTH);
+    map->entries = entries;
+    map->ctrl = ctrl;
+    map->capacity = capacity;
+    return true;
+}
+
 hm* hm_create(void) {
     hm* map = malloc(sizeof(hm));
     if (map == NULL) {
         return NULL;
     }
-    map->capacity = INITIAL_CAPACITY;
     map->length = 0;
-    map->entries = calloc(map->capacity, sizeof(hm_entry));
-    if (map->entries == NULL) {
+    map->pool = NULL;
+    if (!hm_alloc(map, INITIAL_CAPACITY)) {
         free(map);
         return NULL;
     }
     return map;
 }
 
+hm* hm_create_interned(intern_pool* pool) {
+    hm* map = hm_create();
+    if (map != NULL) {
+        map->pool = pool;
+    }
+    return map;
+}
+
 void hm_destroy(hm* map) {
-    for (size_t i = 0; i < map->capacity; i++) {
-        free((void*)map->entries[i].key);
+    if (map->pool == NULL) {
+        for (size_t i = 0; i < map->capacity; i++) {
+            if (map->ctrl[i] >= 0) {
+                free((void*)map->entries[i].key);
+            }
+        }
     }
     free(map->entries);
+    free(map->ctrl);
     free(map);
 }
 
@@ -45,56 +80,56 @@ void hm_destroy(hm* map) {
 
 // Return 64-bit FNV-1a hash for key (NUL-terminated). See description:
 // https://en.wikipedia.org/wiki/Fowler–Noll–Vo_hash_function
+// The result is finalised with a murmur3 mix: the probe uses the high bits
+// and the fingerprint the low seven, and FNV alone mixes both poorly.
 static uint64_t hash_key(const char* key) {
     uint64_t hash = FNV_OFFSET;
     for (const char* p = key; *p; p++) {
         hash ^= (uint64_t)(unsigned char)(*p);
         hash *= FNV_PRIME;
     }
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
     return hash;
 }
 
-void* hm_get(hm* map, const char* key) {
-    const uint64_t hash = hash_key(key);
-    size_t index = (size_t)(hash & (uint64_t)(map->capacity-1));
-
-    while (map->entries[index].key != NULL) {
-        if (strcmp(key, map->entries[index].key) == 0) {
-            return map->entries[index].value;
+/* Index of key's entry, or capacity if absent. */
+static size_t hm_find(const hm* map, const char* key, uint64_t hash) {
+    const size_t group_mask = map->capacity / SWISS_GROUP_WIDTH - 1;
+    const int8_t h2 = swiss_h2(hash);
+    size_t g = swiss_probe_start(hash, group_mask);
+    for (size_t step = 0; step <= group_mask; g = swiss_probe_next(g, ++step, group_mask)) {
+        const size_t base = g * SWISS_GROUP_WIDTH;
+        for (swiss_mask m = swiss_match(map->ctrl + base, h2); m; m = swiss_next(m)) {
+            const size_t i = base + swiss_first(m);
+            if (key == map->entries[i].key || strcmp(key, map->entries[i].key) == 0) {
+                return i;
+            }
         }
-        index++;
-        if (index >= map->capacity) {
-            index = 0;
+        if (swiss_match_empty(map->ctrl + base)) {
+            break;
         }
     }
-    return NULL;
+    return map->capacity;
 }
 
-static const char* hm_set_entry(hm_entry* entries, size_t capacity, const char* key, void* value, size_t* plength) {
-    const uint64_t hash = hash_key(key);
-    size_t index = (size_t)(hash & (uint64_t)(capacity-1));
-
-    while(entries[index].key != NULL) {
-        if (strcmp(key, entries[index].key) == 0) {
-            entries[index].value = value;
-            return entries[index].key;
-        }
-        index++;
-        if (index >= capacity) {
-            index = 0;
+/* First free slot on hash's probe sequence. There always is one. */
+static size_t hm_find_free(const hm* map, uint64_t hash) {
+    const size_t group_mask = map->capacity / SWISS_GROUP_WIDTH - 1;
+    size_t g = swiss_probe_start(hash, group_mask);
+    for (size_t step = 0; ; g = swiss_probe_next(g, ++step, group_mask)) {
+        const size_t base = g * SWISS_GROUP_WIDTH;
+        const swiss_mask m = swiss_match_free(map->ctrl + base);
+        if (m) {
+            return base + swiss_first(m);
         }
     }
+}
 
-    if (plength != NULL) {
-        key = strdup(key);
-        if (key == NULL) {
-            return NULL;
-        }
-        (*plength)++;
-    }
-    entries[index].key = (char*)key;
-    entries[index].value = value;
-    return key;
+void* hm_get(hm* map, const char* key) {
+    const size_t i = hm_find(map, key, hash_key(key));
+    return i == map->capacity ? NULL : map->entries[i].value;
 }
 
 static bool hm_expand(hm* map) {
@@ -102,21 +137,21 @@ static bool hm_expand(hm* map) {
     if (new_capacity < map->capacity) {
         return false;
     }
-    hm_entry* new_entries = calloc(new_capacity, sizeof(hm_entry));
-    if (new_entries == NULL) {
+    hm old = *map;
+    if (!hm_alloc(map, new_capacity)) {
         return false;
     }
 
-    for (size_t i = 0; i < map->capacity; i++) {
-        const hm_entry entry = map->entries[i];
-        if (entry.key != NULL) {
-            hm_set_entry(new_entries, new_capacity, entry.key, entry.value, NULL);
-        }
+    for (size_t i = 0; i < old.capacity; i++) {
+        if (old.ctrl[i] < 0) continue;
+        const uint64_t hash = hash_key(old.entries[i].key);
+        const size_t j = hm_find_free(map, hash);
+        map->ctrl[j] = swiss_h2(hash);
+        map->entries[j] = old.entries[i];
     }
 
-    free(map->entries);
-    map->entries = new_entries;
-    map->capacity = new_capacity;
+    free(old.entries);
+    free(old.ctrl);
     return true;
 }
 
@@ -126,12 +161,30 @@ const char* hm_set(hm* map, const char* key, void* value) {
         return NULL;
     }
 
-    if (map->length >= map->capacity / 2) {
+    const uint64_t hash = hash_key(key);
+    size_t i = hm_find(map, key, hash);
+    if (i != map->capacity) {
+        map->entries[i].value = value;
+        return map->entries[i].key;
+    }
+
+    // Keep at most 7/8 of the slots full so probes end quickly.
+    if (map->length + 1 > map->capacity / 8 * 7) {
         if (!hm_expand(map)) {
             return NULL;
         }
     }
-    return hm_set_entry(map->entries, map->capacity, key, value, &map->length);
+
+    key = map->pool ? intern_str(map->pool, intern(map->pool, key)) : strdup(key);
+    if (key == NULL) {
+        return NULL;
+    }
+    i = hm_find_free(map, hash);
+    map->ctrl[i] = swiss_h2(hash);
+    map->entries[i].key = key;
+    map->entries[i].value = value;
+    map->length++;
+    return key;
 }
 
 size_t hm_length(hm* map) {
@@ -150,7 +203,7 @@ bool hm_next(hmiterator* it) {
     while (it->_index < map->capacity) {
         const size_t i = it->_index;
         it->_index++;
-        if (map->entries[i].key != NULL) {
+        if (map->ctrl[i] >= 0) {
             const hm_entry entry = map->entries[i];
             it->key = entry.key;
             it->value = entry.value;
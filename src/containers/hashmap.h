@@ -4,10 +4,19 @@
 #include <stdbool.h>
 #include <stddef.h>
 
+#include "intern.h"
+
 typedef struct hm hm;
 
 hm* hm_create(void);
 
+/*
+ * Keys are interned into pool (which must outlive the map) instead of
+ * being strdup'd one by one. Keys returned by hm_set/the iterator are the
+ * pooled strings, so intern_lookup() on them is cheap.
+ */
+hm* hm_create_interned(intern_pool* pool);
+
 void hm_destroy(hm* map);
 
 void* hm_get(hm* map, const char* key);
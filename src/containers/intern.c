@@ -0,0 +1,215 @@
+#include "intern.h"
+#include "swiss.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define INTERN_CHUNK_SIZE (64 * 1024)
+#define INTERN_INITIAL_CAPACITY 64
+
+typedef struct intern_chunk {
+    struct intern_chunk* next;
+    size_t used;
+    size_t cap;
+    char data[];
+} intern_chunk;
+
+typedef struct {
+    const char* str;
+    uint32_t len;
+    uint64_t hash;
+} intern_entry;
+
+struct intern_pool {
+    intern_chunk* chunks; // newest first
+
+    intern_entry* entries; // indexed by ID
+    size_t count;
+    size_t entries_cap;
+
+    // SwissTable from string to ID (see swiss.h).
+    int8_t* ctrl;
+    uint32_t* ids;
+    size_t capacity;
+};
+
+static void* intern_alloc(size_t size) {
+    void* ptr = malloc(size);
+    if (!ptr) {
+        fprintf(stderr, "intern: out of memory\n");
+        abort();
+    }
+    return ptr;
+}
+
+static uint64_t hash_bytes(const char* s, size_t len) {
+    uint64_t h = 14695981039346656037ULL;
+    for (size_t i = 0; i < len; i++) {
+        h ^= (uint64_t)(unsigned char)s[i];
+        h *= 1099511628211ULL;
+    }
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    return h;
+}
+
+static void alloc_table(intern_pool* p, size_t capacity) {
+    p->ctrl = intern_alloc(capacity);
+    p->ids = intern_alloc(capacity * sizeof(uint32_t));
+    p->capacity = capacity;
+    swiss_ctrl_reset(p->ctrl, capacity / SWISS_GROUP_WIDTH);
+}
+
+intern_pool* intern_new(void) {
+    intern_pool* p = intern_alloc(sizeof(intern_pool));
+    p->chunks = NULL;
+    p->count = 0;
+    p->entries_cap = INTERN_INITIAL_CAPACITY;
+    p->entries = intern_alloc(p->entries_cap * sizeof(intern_entry));
+    alloc_table(p, INTERN_INITIAL_CAPACITY);
+    return p;
+}
+
+void intern_free(intern_pool* p) {
+    if (!p) return;
+    intern_chunk* c = p->chunks;
+    while (c) {
+        intern_chunk* next = c->next;
+        free(c);
+        c = next;
+    }
+    free(p->entries);
+    free(p->ctrl);
+    free(p->ids);
+    free(p);
+}
+
+static size_t find_free(const intern_pool* p, uint64_t h) {
+    const size_t group_mask = p->capacity / SWISS_GROUP_WIDTH - 1;
+    size_t g = swiss_probe_start(h, group_mask);
+    for (size_t step = 0; ; g = swiss_probe_next(g, ++step, group_mask)) {
+        const size_t base = g * SWISS_GROUP_WIDTH;
+        const swiss_mask m = swiss_match_free(p->ctrl + base);
+        if (m) {
+            return base + swiss_first(m);
+        }
+    }
+}
+
+static uint32_t find(const intern_pool* p, const char* s, size_t len, uint64_t h) {
+    const size_t group_mask = p->capacity / SWISS_GROUP_WIDTH - 1;
+    const int8_t h2 = swiss_h2(h);
+    size_t g = swiss_probe_start(h, group_mask);
+    for (size_t step = 0; step <= group_mask; g = swiss_probe_next(g, ++step, group_mask)) {
+        const size_t base = g * SWISS_GROUP_WIDTH;
+        for (swiss_mask m = swiss_match(p->ctrl + base, h2); m; m = swiss_next(m)) {
+            const uint32_t id = p->ids[base + swiss_first(m)];
+            const intern_entry* e = &p->entries[id];
+            if (e->hash == h && e->len == len && memcmp(e->str, s, len) == 0) {
+                return id;
+            }
+        }
+        if (swiss_match_empty(p->ctrl + base)) {
+            break;
+        }
+    }
+    return INTERN_NONE;
+}
+
+static void grow_table(intern_pool* p) {
+    int8_t* old_ctrl = p->ctrl;
+    uint32_t* old_ids = p->ids;
+    alloc_table(p, p->capacity * 2);
+    free(old_ctrl);
+    free(old_ids);
+
+    // Every ID is live and carries its hash: rebuild straight from entries.
+    for (size_t id = 0; id < p->count; id++) {
+        const uint64_t h = p->entries[id].hash;
+        const size_t i = find_free(p, h);
+        p->ctrl[i] = swiss_h2(h);
+        p->ids[i] = (uint32_t)id;
+    }
+}
+
+static const char* arena_copy(intern_pool* p, const char* s, size_t len) {
+    intern_chunk* c = p->chunks;
+    if (!c || c->cap - c->used < len + 1) {
+        const size_t cap = len + 1 > INTERN_CHUNK_SIZE ? len + 1 : INTERN_CHUNK_SIZE;
+        c = intern_alloc(sizeof(intern_chunk) + cap);
+        c->used = 0;
+        c->cap = cap;
+        c->next = p->chunks;
+        p->chunks = c;
+    }
+    char* dst = c->data + c->used;
+    memcpy(dst, s, len);
+    dst[len] = '\0';
+    c->used += len + 1;
+    return dst;
+}
+
+uint32_t intern_n(intern_pool* p, const char* s, size_t len) {
+    const uint64_t h = hash_bytes(s, len);
+    const uint32_t existing = find(p, s, len, h);
+    if (existing != INTERN_NONE) {
+        return existing;
+    }
+    if (p->count >= INTERN_NONE || len > UINT32_MAX) {
+        fprintf(stderr, "intern: too many or too long strings\n");
+        abort();
+    }
+
+    if (p->count + 1 > p->capacity / 8 * 7) {
+        grow_table(p);
+    }
+    if (p->count == p->entries_cap) {
+        p->entries_cap *= 2;
+        intern_entry* tmp = realloc(p->entries, p->entries_cap * sizeof(intern_entry));
+        if (!tmp) {
+            fprintf(stderr, "intern: out of memory\n");
+            abort();
+        }
+        p->entries = tmp;
+    }
+
+    const uint32_t id = (uint32_t)p->count++;
+    p->entries[id].str = arena_copy(p, s, len);
+    p->entries[id].len = (uint32_t)len;
+    p->entries[id].hash = h;
+
+    const size_t i = find_free(p, h);
+    p->ctrl[i] = swiss_h2(h);
+    p->ids[i] = id;
+    return id;
+}
+
+uint32_t intern(intern_pool* p, const char* s) {
+    return intern_n(p, s, strlen(s));
+}
+
+uint32_t intern_lookup_n(intern_pool* p, const char* s, size_t len) {
+    if (!p) return INTERN_NONE;
+    return find(p, s, len, hash_bytes(s, len));
+}
+
+uint32_t intern_lookup(intern_pool* p, const char* s) {
+    return intern_lookup_n(p, s, strlen(s));
+}
+
+const char* intern_str(intern_pool* p, uint32_t id) {
+    if (!p || id >= p->count) return NULL;
+    return p->entries[id].str;
+}
+
+size_t intern_strlen(intern_pool* p, uint32_t id) {
+    if (!p || id >= p->count) return 0;
+    return p->entries[id].len;
+}
+
+size_t intern_count(intern_pool* p) {
+    if (!p) return 0;
+    return p->count;
+}
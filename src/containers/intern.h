@@ -0,0 +1,43 @@
+// intern.h
+#ifndef INTERN_H
+#define INTERN_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * String intern pool: maps each distinct string to a dense uint32_t ID
+ * (0, 1, 2, ... in first-seen order) and back.
+ *
+ * The characters live in a chunked arena owned by the pool, so interning
+ * never mallocs per string and freeing the pool releases everything at
+ * once. Pointers returned by intern_str() stay valid until intern_free().
+ *
+ * Dense IDs let solvers index flat arrays (adjacency lists, distances)
+ * instead of keying hash maps by name.
+ */
+typedef struct intern_pool intern_pool;
+
+#define INTERN_NONE UINT32_MAX
+
+intern_pool* intern_new(void);
+void intern_free(intern_pool* p);
+
+/* ID of s, adding it if new. */
+uint32_t intern(intern_pool* p, const char* s);
+
+/* Same for the first len bytes of s (which need not be NUL-terminated). */
+uint32_t intern_n(intern_pool* p, const char* s, size_t len);
+
+/* ID of s, or INTERN_NONE if it was never interned. */
+uint32_t intern_lookup(intern_pool* p, const char* s);
+uint32_t intern_lookup_n(intern_pool* p, const char* s, size_t len);
+
+/* The pooled, NUL-terminated copy for id. O(1). */
+const char* intern_str(intern_pool* p, uint32_t id);
+size_t intern_strlen(intern_pool* p, uint32_t id);
+
+/* Number of distinct strings; valid IDs are 0 .. intern_count() - 1. */
+size_t intern_count(intern_pool* p);
+
+#endif
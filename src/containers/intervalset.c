@@ -0,0 +1,166 @@
+#include "containers/intervalset.h"
+
+#include <assert.h>
+
+#define INTERVAL_LESS(a, b) ((a).lo < (b).lo || ((a).lo == (b).lo && (a).hi < (b).hi))
+
+VEC_DEFINE_SORT(interval, interval, INTERVAL_LESS)
+
+/* A run starting at lo joins one ending at hi (lo >= the earlier run's
+ * start): they overlap, or lo is right after hi. */
+static inline bool joins(int64_t hi, int64_t lo) {
+    return lo <= hi || (hi < INT64_MAX && lo == hi + 1);
+}
+
+void intervalset_init(intervalset* s) {
+    vec_interval_init(&s->runs);
+    s->normalized = true;
+}
+
+void intervalset_free(intervalset* s) {
+    if (!s) return;
+    vec_interval_free(&s->runs);
+    s->normalized = true;
+}
+
+void intervalset_clear(intervalset* s) {
+    vec_interval_clear(&s->runs);
+    s->normalized = true;
+}
+
+void intervalset_add(intervalset* s, int64_t lo, int64_t hi) {
+    if (lo > hi) {
+        const int64_t t = lo;
+        lo = hi;
+        hi = t;
+    }
+    vec_interval_push(&s->runs, (interval){lo, hi});
+    s->normalized = s->runs.len == 1;
+}
+
+void intervalset_add_bulk(intervalset* s, const interval* items, size_t n) {
+    vec_interval_reserve(&s->runs, s->runs.len + n);
+    for (size_t i = 0; i < n; i++) intervalset_add(s, items[i].lo, items[i].hi);
+}
+
+/* Append [lo, hi] to a run list built in ascending order of lo, merging
+ * with the last run if they overlap or touch. */
+static void append_run(vec_interval* runs, int64_t lo, int64_t hi) {
+    if (runs->len > 0) {
+        interval* last = &runs->data[runs->len - 1];
+        if (joins(last->hi, lo)) {
+            if (hi > last->hi) last->hi = hi;
+            return;
+        }
+    }
+    vec_interval_push(runs, (interval){lo, hi});
+}
+
+void intervalset_normalize(intervalset* s) {
+    if (s->normalized) return;
+    interval* r = s->runs.data;
+    const size_t n = s->runs.len;
+    vec_interval_sort_range(r, n);
+
+    // Merge in place: the write index never passes the read index.
+    size_t out = 0;
+    for (size_t i = 1; i < n; i++) {
+        if (joins(r[out].hi, r[i].lo)) {
+            if (r[i].hi > r[out].hi) r[out].hi = r[i].hi;
+        } else {
+            r[++out] = r[i];
+        }
+    }
+    s->runs.len = n ? out + 1 : 0;
+    s->normalized = true;
+}
+
+bool intervalset_contains(const intervalset* s, int64_t x) {
+    assert(s->normalized);
+    // First run ending at or after x; x is in the set iff it starts by x.
+    size_t lo = 0, hi = s->runs.len;
+    while (lo < hi) {
+        const size_t mid = lo + (hi - lo) / 2;
+        if (s->runs.data[mid].hi < x) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo < s->runs.len && s->runs.data[lo].lo <= x;
+}
+
+size_t intervalset_contains_sorted(const intervalset* s, const int64_t* xs, size_t n, bool* hits) {
+    assert(s->normalized);
+    const interval* r = s->runs.data;
+    const size_t runs = s->runs.len;
+    size_t j = 0, count = 0;
+    for (size_t i = 0; i < n; i++) {
+        assert(i == 0 || xs[i - 1] <= xs[i]);
+        while (j < runs && r[j].hi < xs[i]) j++;
+        const bool hit = j < runs && r[j].lo <= xs[i];
+        count += hit;
+        if (hits) hits[i] = hit;
+    }
+    return count;
+}
+
+uint64_t intervalset_covered(const intervalset* s) {
+    assert(s->normalized);
+    uint64_t total = 0;
+    for (size_t i = 0; i < s->runs.len; i++) {
+        total += (uint64_t)s->runs.data[i].hi - (uint64_t)s->runs.data[i].lo + 1;
+    }
+    return total;
+}
+
+void intervalset_union(intervalset* out, const intervalset* a, const intervalset* b) {
+    assert(a->normalized && b->normalized && out != a && out != b);
+    intervalset_clear(out);
+    vec_interval_reserve(&out->runs, a->runs.len + b->runs.len);
+    size_t i = 0, j = 0;
+    while (i < a->runs.len || j < b->runs.len) {
+        const interval next = (j == b->runs.len
+                               || (i < a->runs.len && a->runs.data[i].lo <= b->runs.data[j].lo))
+                                  ? a->runs.data[i++]
+                                  : b->runs.data[j++];
+        append_run(&out->runs, next.lo, next.hi);
+    }
+}
+
+void intervalset_intersect(intervalset* out, const intervalset* a, const intervalset* b) {
+    assert(a->normalized && b->normalized && out != a && out != b);
+    intervalset_clear(out);
+    size_t i = 0, j = 0;
+    while (i < a->runs.len && j < b->runs.len) {
+        const interval x = a->runs.data[i];
+        const interval y = b->runs.data[j];
+        const int64_t lo = x.lo > y.lo ? x.lo : y.lo;
+        const int64_t hi = x.hi < y.hi ? x.hi : y.hi;
+        if (lo <= hi) vec_interval_push(&out->runs, (interval){lo, hi});
+        // Whichever ends first can't meet anything further on the other side.
+        if (x.hi < y.hi) i++;
+        else j++;
+    }
+}
+
+void intervalset_difference(intervalset* out, const intervalset* a, const intervalset* b) {
+    assert(a->normalized && b->normalized && out != a && out != b);
+    intervalset_clear(out);
+    size_t j = 0;
+    for (size_t i = 0; i < a->runs.len; i++) {
+        int64_t lo = a->runs.data[i].lo;
+        const int64_t hi = a->runs.data[i].hi;
+        while (j < b->runs.len && b->runs.data[j].hi < lo) j++;
+        // Cut out every run of b overlapping [lo, hi]. The last one may
+        // reach into a's next run, so j stays on it.
+        bool left = true;
+        for (size_t k = j; k < b->runs.len && b->runs.data[k].lo <= hi; k++) {
+            const interval cut = b->runs.data[k];
+            if (cut.lo > lo) vec_interval_push(&out->runs, (interval){lo, cut.lo - 1});
+            if (cut.hi >= hi) {
+                left = false;
+                break;
+            }
+            lo = cut.hi + 1;
+        }
+        if (left) vec_interval_push(&out->runs, (interval){lo, hi});
+    }
+}
@@ -0,0 +1,74 @@
+// intervalset.h
+#ifndef INTERVALSET_H
+#define INTERVALSET_H
+
+/**
+ * Sets of integers stored as closed intervals [lo, hi].
+ *
+ * Build by adding intervals in any order (one at a time or in bulk), then
+ * normalize: that sorts them and merges every overlapping or touching
+ * pair, leaving disjoint runs in ascending order. Queries and set
+ * operations need a normalized set and assert so; the set operations
+ * produce normalized results in one linear merge of their inputs.
+ *
+ *   intervalset s;
+ *   intervalset_init(&s);
+ *   intervalset_add(&s, 3, 5);
+ *   intervalset_add(&s, 10, 14);
+ *   intervalset_normalize(&s);
+ *   intervalset_covered(&s);                       // 8
+ *   intervalset_contains_sorted(&s, ids, n, NULL); // ids ascending
+ *   intervalset_free(&s);
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "typed_vec.h"
+
+typedef struct {
+    int64_t lo;
+    int64_t hi;
+} interval;
+
+VEC_DEFINE(interval, interval)
+
+typedef struct {
+    vec_interval runs;
+    bool normalized;
+} intervalset;
+
+void intervalset_init(intervalset* s);
+void intervalset_free(intervalset* s);
+void intervalset_clear(intervalset* s);
+
+/* Add [lo, hi] (swapped if given backwards). Leaves s unnormalized. */
+void intervalset_add(intervalset* s, int64_t lo, int64_t hi);
+void intervalset_add_bulk(intervalset* s, const interval* items, size_t n);
+
+/* Sort and merge overlapping or adjacent intervals, in place. */
+void intervalset_normalize(intervalset* s);
+
+/* Number of disjoint runs. */
+static inline size_t intervalset_runs(const intervalset* s) {
+    return s->runs.len;
+}
+
+bool intervalset_contains(const intervalset* s, int64_t x);
+
+/**
+ * Membership of n ascending values in one merge-join pass. Sets hits[i]
+ * (if hits is non-NULL) and returns how many are members.
+ */
+size_t intervalset_contains_sorted(const intervalset* s, const int64_t* xs, size_t n, bool* hits);
+
+/* Number of integers covered. */
+uint64_t intervalset_covered(const intervalset* s);
+
+/* out = a op b. out must not be a or b; its old contents are dropped. */
+void intervalset_union(intervalset* out, const intervalset* a, const intervalset* b);
+void intervalset_intersect(intervalset* out, const intervalset* a, const intervalset* b);
+void intervalset_difference(intervalset* out, const intervalset* a, const intervalset* b);
+
+#endif
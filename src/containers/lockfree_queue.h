@@ -0,0 +1,247 @@
+// lockfree_queue.h
+#ifndef LOCKFREE_QUEUE_H
+#define LOCKFREE_QUEUE_H
+
+/**
+ * Bounded lock-free queues for handing work between threads, generated
+ * by macro like ring.h.
+ *
+ *   SPSC_DEFINE(line, Line)   spsc_line: one producer, one consumer
+ *   MPMC_DEFINE(job, Job)     mpmc_job:  any number of either
+ *
+ * Both take a capacity at init (rounded up to a power of two) and never
+ * allocate afterwards: try_push fails when full, try_pop when empty.
+ * push_wait/pop_wait spin (then yield) until they succeed; pop_wait also
+ * returns false once the queue is closed and drained.
+ *
+ * Indices written by different threads sit on separate cache lines so
+ * producers and consumers don't false-share. That needs the queue struct
+ * itself to be 64-byte aligned, which automatic and static variables are;
+ * use aligned_alloc if you put one on the heap.
+ *
+ * SPSC is a classic Lamport ring where each side caches the other's index
+ * and only re-reads it when the cache says full/empty. MPMC is Dmitry
+ * Vyukov's bounded queue: every cell carries a sequence number, so
+ * producers and consumers claim slots with one CAS and never wait on
+ * each other except at the cell they share.
+ */
+
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define LFQ_CACHE_LINE 64
+
+static inline void lfq_cpu_relax(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+/* Back off: spin briefly, then give the core away. */
+static inline void lfq_backoff(unsigned* spins) {
+    if (++*spins < 64) {
+        lfq_cpu_relax();
+    } else {
+        sched_yield();
+    }
+}
+
+static inline size_t lfq_round_capacity(size_t n) {
+    size_t cap = 2;
+    while (cap < n) cap *= 2;
+    return cap;
+}
+
+static inline void* lfq_alloc(size_t size, const char* who) {
+    void* p = malloc(size);
+    if (!p) {
+        fprintf(stderr, "%s: out of memory\n", who);
+        abort();
+    }
+    return p;
+}
+
+// ---- single producer, single consumer ----------------------------------------
+
+#define SPSC_DEFINE(name, T)                                                       \
+    typedef struct {                                                               \
+        /* read-only after init */                                                 \
+        _Alignas(LFQ_CACHE_LINE) T* data;                                          \
+        size_t mask;                                                               \
+        /* consumer side */                                                        \
+        _Alignas(LFQ_CACHE_LINE) _Atomic size_t head;                              \
+        size_t cached_tail;                                                        \
+        /* producer side */                                                        \
+        _Alignas(LFQ_CACHE_LINE) _Atomic size_t tail;                              \
+        size_t cached_head;                                                        \
+        _Atomic bool closed;                                                       \
+    } spsc_##name;                                                                 \
+                                                                                   \
+    static inline void spsc_##name##_init(spsc_##name* q, size_t capacity) {       \
+        const size_t cap = lfq_round_capacity(capacity);                           \
+        q->data = (T*)lfq_alloc(cap * sizeof(T), "spsc_" #name "_init");           \
+        q->mask = cap - 1;                                                         \
+        atomic_init(&q->head, 0);                                                  \
+        atomic_init(&q->tail, 0);                                                  \
+        atomic_init(&q->closed, false);                                            \
+        q->cached_tail = 0;                                                        \
+        q->cached_head = 0;                                                        \
+    }                                                                              \
+                                                                                   \
+    static inline void spsc_##name##_free(spsc_##name* q) {                        \
+        if (!q) return;                                                            \
+        free(q->data);                                                             \
+        q->data = NULL;                                                            \
+    }                                                                              \
+                                                                                   \
+    /* Producer only. */                                                          \
+    static inline bool spsc_##name##_try_push(spsc_##name* q, T item) {            \
+        const size_t tail = atomic_load_explicit(&q->tail, memory_order_relaxed);  \
+        if (tail - q->cached_head > q->mask) {                                     \
+            q->cached_head = atomic_load_explicit(&q->head, memory_order_acquire); \
+            if (tail - q->cached_head > q->mask) return false;                     \
+        }                                                                          \
+        q->data[tail & q->mask] = item;                                            \
+        atomic_store_explicit(&q->tail, tail + 1, memory_order_release);           \
+        return true;                                                               \
+    }                                                                              \
+                                                                                   \
+    /* Consumer only. */                                                          \
+    static inline bool spsc_##name##_try_pop(spsc_##name* q, T* out) {             \
+        const size_t head = atomic_load_explicit(&q->head, memory_order_relaxed);  \
+        if (head == q->cached_tail) {                                              \
+            q->cached_tail = atomic_load_explicit(&q->tail, memory_order_acquire); \
+            if (head == q->cached_tail) return false;                              \
+        }                                                                          \
+        *out = q->data[head & q->mask];                                            \
+        atomic_store_explicit(&q->head, head + 1, memory_order_release);           \
+        return true;                                                               \
+    }                                                                              \
+                                                                                   \
+    static inline void spsc_##name##_push_wait(spsc_##name* q, T item) {           \
+        unsigned spins = 0;                                                        \
+        while (!spsc_##name##_try_push(q, item)) lfq_backoff(&spins);              \
+    }                                                                              \
+                                                                                   \
+    /* Producer: no more pushes will follow. */                                   \
+    static inline void spsc_##name##_close(spsc_##name* q) {                       \
+        atomic_store_explicit(&q->closed, true, memory_order_release);             \
+    }                                                                              \
+                                                                                   \
+    /* Blocks for the next item; false once closed and empty. */                  \
+    static inline bool spsc_##name##_pop_wait(spsc_##name* q, T* out) {            \
+        unsigned spins = 0;                                                        \
+        for (;;) {                                                                 \
+            if (spsc_##name##_try_pop(q, out)) return true;                        \
+            if (atomic_load_explicit(&q->closed, memory_order_acquire)) {          \
+                return spsc_##name##_try_pop(q, out);                              \
+            }                                                                      \
+            lfq_backoff(&spins);                                                   \
+        }                                                                          \
+    }
+
+// ---- multi producer, multi consumer (Vyukov) ---------------------------------
+
+#define MPMC_DEFINE(name, T)                                                       \
+    typedef struct {                                                               \
+        _Atomic size_t seq;                                                        \
+        T value;                                                                   \
+    } mpmc_##name##_cell;                                                          \
+                                                                                   \
+    typedef struct {                                                               \
+        _Alignas(LFQ_CACHE_LINE) mpmc_##name##_cell* cells;                        \
+        size_t mask;                                                               \
+        _Alignas(LFQ_CACHE_LINE) _Atomic size_t enqueue_pos;                       \
+        _Alignas(LFQ_CACHE_LINE) _Atomic size_t dequeue_pos;                       \
+        _Alignas(LFQ_CACHE_LINE) _Atomic bool closed;                              \
+    } mpmc_##name;                                                                 \
+                                                                                   \
+    static inline void mpmc_##name##_init(mpmc_##name* q, size_t capacity) {       \
+        const size_t cap = lfq_round_capacity(capacity);                           \
+        q->cells = (mpmc_##name##_cell*)lfq_alloc(cap * sizeof(mpmc_##name##_cell), \
+                                                  "mpmc_" #name "_init");          \
+        for (size_t i = 0; i < cap; i++) atomic_init(&q->cells[i].seq, i);         \
+        q->mask = cap - 1;                                                         \
+        atomic_init(&q->enqueue_pos, 0);                                           \
+        atomic_init(&q->dequeue_pos, 0);                                           \
+        atomic_init(&q->closed, false);                                            \
+    }                                                                              \
+                                                                                   \
+    static inline void mpmc_##name##_free(mpmc_##name* q) {                        \
+        if (!q) return;                                                            \
+        free(q->cells);                                                            \
+        q->cells = NULL;                                                           \
+    }                                                                              \
+                                                                                   \
+    static inline bool mpmc_##name##_try_push(mpmc_##name* q, T item) {            \
+        size_t pos = atomic_load_explicit(&q->enqueue_pos, memory_order_relaxed);  \
+        mpmc_##name##_cell* cell;                                                  \
+        for (;;) {                                                                 \
+            cell = &q->cells[pos & q->mask];                                       \
+            const size_t seq = atomic_load_explicit(&cell->seq, memory_order_acquire); \
+            const intptr_t dif = (intptr_t)seq - (intptr_t)pos;                    \
+            if (dif == 0) {                                                        \
+                if (atomic_compare_exchange_weak_explicit(&q->enqueue_pos, &pos, pos + 1, \
+                        memory_order_relaxed, memory_order_relaxed)) break;        \
+            } else if (dif < 0) {                                                  \
+                return false; /* full */                                           \
+            } else {                                                               \
+                pos = atomic_load_explicit(&q->enqueue_pos, memory_order_relaxed); \
+            }                                                                      \
+        }                                                                          \
+        cell->value = item;                                                        \
+        atomic_store_explicit(&cell->seq, pos + 1, memory_order_release);          \
+        return true;                                                               \
+    }                                                                              \
+                                                                                   \
+    static inline bool mpmc_##name##_try_pop(mpmc_##name* q, T* out) {             \
+        size_t pos = atomic_load_explicit(&q->dequeue_pos, memory_order_relaxed);  \
+        mpmc_##name##_cell* cell;                                                  \
+        for (;;) {                                                                 \
+            cell = &q->cells[pos & q->mask];                                       \
+            const size_t seq = atomic_load_explicit(&cell->seq, memory_order_acquire); \
+            const intptr_t dif = (intptr_t)seq - (intptr_t)(pos + 1);              \
+            if (dif == 0) {                                                        \
+                if (atomic_compare_exchange_weak_explicit(&q->dequeue_pos, &pos, pos + 1, \
+                        memory_order_relaxed, memory_order_relaxed)) break;        \
+            } else if (dif < 0) {                                                  \
+                return false; /* empty */                                          \
+            } else {                                                               \
+                pos = atomic_load_explicit(&q->dequeue_pos, memory_order_relaxed); \
+            }                                                                      \
+        }                                                                          \
+        *out = cell->value;                                                        \
+        atomic_store_explicit(&cell->seq, pos + q->mask + 1, memory_order_release); \
+        return true;                                                               \
+    }                                                                              \
+                                                                                   \
+    static inline void mpmc_##name##_push_wait(mpmc_##name* q, T item) {           \
+        unsigned spins = 0;                                                        \
+        while (!mpmc_##name##_try_push(q, item)) lfq_backoff(&spins);              \
+    }                                                                              \
+                                                                                   \
+    /* No more pushes will follow (call after every producer is done). */         \
+    static inline void mpmc_##name##_close(mpmc_##name* q) {                       \
+        atomic_store_explicit(&q->closed, true, memory_order_release);             \
+    }                                                                              \
+                                                                                   \
+    /* Blocks for the next item; false once closed and empty. */                  \
+    static inline bool mpmc_##name##_pop_wait(mpmc_##name* q, T* out) {            \
+        unsigned spins = 0;                                                        \
+        for (;;) {                                                                 \
+            if (mpmc_##name##_try_pop(q, out)) return true;                        \
+            if (atomic_load_explicit(&q->closed, memory_order_acquire)) {          \
+                return mpmc_##name##_try_pop(q, out);                              \
+            }                                                                      \
+            lfq_backoff(&spins);                                                   \
+        }                                                                          \
+    }
+
+#endif
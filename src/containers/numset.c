@@ -1,19 +1,22 @@
 #include "numset.h"
+#include "swiss.h"
 
 #include <stdlib.h>
 #include <stdio.h>
 #include <stdint.h>
 #include <string.h>
 
-typedef struct {
-    long long value;
-    bool used;
-} numset_entry;
-
+/*
+ * SwissTable layout: ctrl[i] tags values[i] (see swiss.h). Capacity is a
+ * power of two and a multiple of the group width. A slot costs 9 bytes
+ * and the table fills to 7/8 before growing.
+ */
 struct numset {
-    numset_entry* entries;
+    long long* values;
+    int8_t* ctrl;
     size_t capacity;
     size_t length;
+    size_t tombstones; // DELETED tags, reclaimed on the next rehash
 };
 
 #define NUMSET_INITIAL_CAPACITY 16
@@ -27,33 +30,30 @@ static uint64_t hash_u64(uint64_t x) {
     return x;
 }
 
-static size_t next_power_of_two(size_t x) {
-    if (x < 2) return 2;
-    x--;
-    x |= x >> 1;
-    x |= x >> 2;
-    x |= x >> 4;
-    x |= x >> 8;
-    x |= x >> 16;
-#if SIZE_MAX > 0xFFFFFFFFu
-    x |= x >> 32;
-#endif
-    x++;
-    return x;
+static bool numset_alloc(numset* s, size_t capacity) {
+    long long* values = malloc(capacity * sizeof(long long));
+    int8_t* ctrl = malloc(capacity);
+    if (!values || !ctrl) {
+        free(values);
+        free(ctrl);
+        return false;
+    }
+    swiss_ctrl_reset(ctrl, capacity / SWISS_GROUP_WIDTH);
+    s->values = values;
+    s->ctrl = ctrl;
+    s->capacity = capacity;
+    return true;
 }
 
-static bool numset_expand(numset* s);
-
 numset* numset_new(void) {
     numset* s = malloc(sizeof(numset));
     if (!s) {
         fprintf(stderr, "numset_new: out of memory\n");
         abort();
     }
-    s->capacity = NUMSET_INITIAL_CAPACITY;
     s->length = 0;
-    s->entries = calloc(s->capacity, sizeof(numset_entry));
-    if (!s->entries) {
+    s->tombstones = 0;
+    if (!numset_alloc(s, NUMSET_INITIAL_CAPACITY)) {
         fprintf(stderr, "numset_new: out of memory (entries)\n");
         free(s);
         abort();
@@ -63,76 +63,155 @@ numset* numset_new(void) {
 
 void numset_free(numset* s) {
     if (!s) return;
-    free(s->entries);
+    free(s->values);
+    free(s->ctrl);
     free(s);
 }
 
-static bool numset_expand(numset* s) {
-    size_t new_capacity = s->capacity * 2;
-    new_capacity = next_power_of_two(new_capacity);
-    numset_entry* new_entries = calloc(new_capacity, sizeof(numset_entry));
-    if (!new_entries) {
-        fprintf(stderr, "numset_expand: out of memory\n");
+/* First free slot on h's probe sequence. There always is one. */
+static size_t numset_find_free(const numset* s, uint64_t h) {
+    const size_t group_mask = s->capacity / SWISS_GROUP_WIDTH - 1;
+    size_t g = swiss_probe_start(h, group_mask);
+    for (size_t step = 0; ; g = swiss_probe_next(g, ++step, group_mask)) {
+        const size_t base = g * SWISS_GROUP_WIDTH;
+        const swiss_mask m = swiss_match_free(s->ctrl + base);
+        if (m) {
+            return base + swiss_first(m);
+        }
+    }
+}
+
+static bool numset_rehash(numset* s, size_t new_capacity) {
+    numset old = *s;
+    if (!numset_alloc(s, new_capacity)) {
+        fprintf(stderr, "numset_rehash: out of memory\n");
         return false;
     }
+    s->tombstones = 0;
+
+    for (size_t i = 0; i < old.capacity; i++) {
+        if (old.ctrl[i] < 0) continue;
+        const long long v = old.values[i];
+        const uint64_t h = hash_u64((uint64_t)v);
+        const size_t j = numset_find_free(s, h);
+        s->ctrl[j] = swiss_h2(h);
+        s->values[j] = v;
+    }
 
-    for (size_t i = 0; i < s->capacity; i++) {
-        if (s->entries[i].used) {
-            const long long v = s->entries[i].value;
-            const uint64_t h = hash_u64((uint64_t)v);
-            size_t idx = (size_t)(h & (new_capacity - 1));
+    free(old.values);
+    free(old.ctrl);
+    return true;
+}
 
-            while (new_entries[idx].used) {
-                idx = (idx + 1) % new_capacity;
+/* Largest number of values capacity holds at the maximum load. */
+static size_t max_load(size_t capacity) {
+    return capacity / 8 * 7;
+}
+
+/* Make room for one more value, growing or purging tombstones. */
+static bool numset_make_room(numset* s) {
+    if (s->length + s->tombstones + 1 <= max_load(s->capacity)) {
+        return true;
+    }
+    // Mostly tombstones: rebuild at the same size instead of doubling.
+    if (s->length + 1 <= max_load(s->capacity) / 2) {
+        return numset_rehash(s, s->capacity);
+    }
+    return numset_rehash(s, s->capacity * 2);
+}
+
+/* Index of value's slot, or capacity if absent. */
+static size_t numset_find(const numset* s, long long value, uint64_t h) {
+    const size_t group_mask = s->capacity / SWISS_GROUP_WIDTH - 1;
+    const int8_t h2 = swiss_h2(h);
+    size_t g = swiss_probe_start(h, group_mask);
+    for (size_t step = 0; step <= group_mask; g = swiss_probe_next(g, ++step, group_mask)) {
+        const size_t base = g * SWISS_GROUP_WIDTH;
+        for (swiss_mask m = swiss_match(s->ctrl + base, h2); m; m = swiss_next(m)) {
+            const size_t i = base + swiss_first(m);
+            if (s->values[i] == value) {
+                return i;
             }
-            new_entries[idx].value = v;
-            new_entries[idx].used = true;
+        }
+        if (swiss_match_empty(s->ctrl + base)) {
+            break;
         }
     }
-
-    free(s->entries);
-    s->entries = new_entries;
-    s->capacity = new_capacity;
-    return true;
+    return s->capacity;
 }
 
 bool numset_add(numset* s, long long value) {
     if (!s) return false;
 
-    if (s->length * 2 >= s->capacity) {
-        if (!numset_expand(s)) {
-            return false;
-        }
-    }
-
     const uint64_t h = hash_u64((uint64_t)value);
-    size_t idx = (size_t)(h & (s->capacity - 1));
-
-    while (s->entries[idx].used) {
-        if (s->entries[idx].value == value) {
-            return false;
-        }
-        idx = (idx + 1) % s->capacity;
+    if (numset_find(s, value, h) != s->capacity) {
+        return false;
+    }
+    if (!numset_make_room(s)) {
+        return false;
     }
 
-    s->entries[idx].value = value;
-    s->entries[idx].used = true;
+    const size_t idx = numset_find_free(s, h);
+    if (s->ctrl[idx] == SWISS_DELETED) s->tombstones--;
+    s->ctrl[idx] = swiss_h2(h);
+    s->values[idx] = value;
     s->length++;
     return true;
 }
 
+size_t numset_add_bulk(numset* s, const long long* values, size_t n) {
+    if (!s || !values) return 0;
+    numset_reserve(s, s->length + n);
+
+    size_t added = 0;
+    for (size_t i = 0; i < n; i++) {
+        // Repeats in sorted input cost a compare, not a probe.
+        if (i > 0 && values[i] == values[i - 1]) continue;
+        added += numset_add(s, values[i]);
+    }
+    return added;
+}
+
 bool numset_contains(numset* s, long long value) {
     if (!s) return false;
-    const uint64_t h = hash_u64((uint64_t)value);
-    size_t idx = (size_t)(h & (s->capacity - 1));
+    return numset_find(s, value, hash_u64((uint64_t)value)) != s->capacity;
+}
 
-    while (s->entries[idx].used) {
-        if (s->entries[idx].value == value) {
-            return true;
-        }
-        idx = (idx + 1) % s->capacity;
+bool numset_remove(numset* s, long long value) {
+    if (!s) return false;
+    const size_t i = numset_find(s, value, hash_u64((uint64_t)value));
+    if (i == s->capacity) return false;
+
+    // A group that still has an EMPTY slot has never been full, so no
+    // probe ever continued past it and the slot can go straight back to
+    // EMPTY. Otherwise leave a tombstone to keep later probes going.
+    const int8_t* group = s->ctrl + i / SWISS_GROUP_WIDTH * SWISS_GROUP_WIDTH;
+    if (swiss_match_empty(group)) {
+        s->ctrl[i] = SWISS_EMPTY;
+    } else {
+        s->ctrl[i] = SWISS_DELETED;
+        s->tombstones++;
     }
-    return false;
+    s->length--;
+    return true;
+}
+
+void numset_reserve(numset* s, size_t n) {
+    if (!s) return;
+    size_t cap = s->capacity;
+    while (max_load(cap) < n) {
+        cap *= 2;
+    }
+    if (cap > s->capacity) {
+        numset_rehash(s, cap);
+    }
+}
+
+void numset_clear(numset* s) {
+    if (!s) return;
+    swiss_ctrl_reset(s->ctrl, s->capacity / SWISS_GROUP_WIDTH);
+    s->length = 0;
+    s->tombstones = 0;
 }
 
 size_t numset_size(numset* s) {
@@ -153,8 +232,8 @@ bool numset_next(numset_iter* it, long long* out_value) {
 
     while (it->_index < s->capacity) {
         const size_t i = it->_index++;
-        if (s->entries[i].used) {
-            *out_value = s->entries[i].value;
+        if (s->ctrl[i] >= 0) {
+            *out_value = s->values[i];
             return true;
         }
     }
@@ -12,8 +12,23 @@ void numset_free(numset* s);
 
 bool numset_add(numset* s, long long value);
 
+/*
+ * Add n values, reserving room for all of them first. Equal neighbours
+ * are skipped before hashing, so sorted input with repeats is cheap.
+ * Returns the number of values that were new.
+ */
+size_t numset_add_bulk(numset* s, const long long* values, size_t n);
+
 bool numset_contains(numset* s, long long value);
 
+bool numset_remove(numset* s, long long value);
+
+/* Make room for n values in total without further rehashing. */
+void numset_reserve(numset* s, size_t n);
+
+/* Drop all values but keep the allocation. */
+void numset_clear(numset* s);
+
 size_t numset_size(numset* s);
 
 typedef struct {
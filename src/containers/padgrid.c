@@ -0,0 +1,84 @@
+#include "containers/padgrid.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+padgrid* padgrid_new(int width, int height, int border, char sentinel) {
+    if (width <= 0 || height <= 0 || border < 0) {
+        return NULL;
+    }
+
+    padgrid* g = malloc(sizeof(padgrid));
+    if (!g) {
+        fprintf(stderr, "padgrid_new: out of memory\n");
+        abort();
+    }
+
+    g->width = width;
+    g->height = height;
+    g->border = border;
+    g->sentinel = sentinel;
+    g->stride = (ptrdiff_t)width + 2 * border;
+
+    const size_t rows = (size_t)height + 2 * (size_t)border;
+    g->alloc = malloc(rows * (size_t)g->stride);
+    if (!g->alloc) {
+        fprintf(stderr, "padgrid_new: out of memory (cells)\n");
+        free(g);
+        abort();
+    }
+    memset(g->alloc, sentinel, rows * (size_t)g->stride);
+    g->cells = g->alloc + (ptrdiff_t)border * g->stride + border;
+    for (int y = 0; y < height; y++) {
+        memset(g->cells + (ptrdiff_t)y * g->stride, 0, (size_t)width);
+    }
+
+    for (int d = 0; d < 4; d++) {
+        g->dirs4[d] = (ptrdiff_t)DIRS4[d].y * g->stride + DIRS4[d].x;
+    }
+    for (int d = 0; d < 8; d++) {
+        g->dirs8[d] = (ptrdiff_t)DIRS8[d].y * g->stride + DIRS8[d].x;
+    }
+    return g;
+}
+
+padgrid* padgrid_from_grid(const Grid* src, int border, char sentinel) {
+    if (!src) return NULL;
+    padgrid* g = padgrid_new(src->width, src->height, border, sentinel);
+    if (!g) return NULL;
+
+    // Rows are contiguous in row-major grids, tile-wide spans in tiled ones.
+    const int span = src->layout == GRID_TILED ? GRID_TILE : src->width;
+    for (int y = 0; y < src->height; y++) {
+        for (int x = 0; x < src->width; x += span) {
+            const int n = src->width - x < span ? src->width - x : span;
+            memcpy(g->cells + (ptrdiff_t)y * g->stride + x,
+                   src->cells + grid_index(src, x, y), (size_t)n);
+        }
+    }
+    return g;
+}
+
+padgrid* padgrid_from_string(const char* input, int border, char sentinel) {
+    Grid* src = grid_from_string(input);
+    padgrid* g = padgrid_from_grid(src, border, sentinel);
+    grid_free(src);
+    return g;
+}
+
+void padgrid_free(padgrid* g) {
+    if (!g) return;
+    free(g->alloc);
+    free(g);
+}
+
+ptrdiff_t padgrid_find(const padgrid* g, char c) {
+    if (!g) return -1;
+    for (int y = 0; y < g->height; y++) {
+        const char* row = g->cells + (ptrdiff_t)y * g->stride;
+        const char* hit = memchr(row, c, (size_t)g->width);
+        if (hit) return (ptrdiff_t)y * g->stride + (hit - row);
+    }
+    return -1;
+}
@@ -0,0 +1,77 @@
+// padgrid.h
+#ifndef PADGRID_H
+#define PADGRID_H
+
+/**
+ * A char grid surrounded by `border` rings of sentinel cells, for
+ * neighbour loops without bounds checks.
+ *
+ * Cells are addressed by a linear index (y * stride + x, with (0,0) at
+ * index 0); reading up to `border` steps outside the grid lands on a
+ * sentinel instead of out of the allocation. dirs4/dirs8 hold the index
+ * offsets of DIRS4/DIRS8 (point.h), in the same order, so
+ *
+ *     for (int d = 0; d < 4; d++) {
+ *         const ptrdiff_t n = i + g->dirs4[d];
+ *         if (g->cells[n] == '#') continue;   // walls and border alike
+ *         ...
+ *     }
+ *
+ * is a handful of indexed loads. Choose a sentinel the solver already
+ * treats as blocked.
+ *
+ * Accessors are inline and unchecked; use grid.h when you want
+ * grid_get's forgiving out-of-range behaviour.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "grid.h"
+#include "point.h"
+
+typedef struct {
+    int width;
+    int height;
+    int border;          // sentinel rings on every side
+    char sentinel;
+    ptrdiff_t stride;    // width + 2 * border
+    char* cells;         // cell (0, 0)
+    char* alloc;
+    ptrdiff_t dirs4[4];  // index offsets of DIRS4
+    ptrdiff_t dirs8[8];  // index offsets of DIRS8
+} padgrid;
+
+/* Interior zeroed, border filled with sentinel. NULL on bad dimensions. */
+padgrid* padgrid_new(int width, int height, int border, char sentinel);
+padgrid* padgrid_from_grid(const Grid* g, int border, char sentinel);
+/* Same input rules as grid_from_string. */
+padgrid* padgrid_from_string(const char* input, int border, char sentinel);
+void padgrid_free(padgrid* g);
+
+/* Valid for -border <= x < width + border, likewise y. */
+static inline ptrdiff_t padgrid_index(const padgrid* g, int x, int y) {
+    return (ptrdiff_t)y * g->stride + x;
+}
+
+/* Inverse of padgrid_index for cells inside the grid. */
+static inline Point padgrid_point(const padgrid* g, ptrdiff_t i) {
+    return (Point){ (int)(i % g->stride), (int)(i / g->stride) };
+}
+
+static inline bool padgrid_in_bounds(const padgrid* g, int x, int y) {
+    return x >= 0 && x < g->width && y >= 0 && y < g->height;
+}
+
+static inline char padgrid_get(const padgrid* g, int x, int y) {
+    return g->cells[padgrid_index(g, x, y)];
+}
+
+static inline void padgrid_set(padgrid* g, int x, int y, char value) {
+    g->cells[padgrid_index(g, x, y)] = value;
+}
+
+/* Index of the first cell holding c, row by row, or -1. */
+ptrdiff_t padgrid_find(const padgrid* g, char c);
+
+#endif
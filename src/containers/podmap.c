@@ -0,0 +1,253 @@
+#include "podmap.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+struct podmap {
+    uint64_t* hashes;     // 0 = empty slot
+    unsigned char* slots; // key, padding, value; `stride` bytes each
+    size_t key_size;
+    size_t value_size;
+    size_t value_offset;
+    size_t stride;
+    size_t capacity;      // power of two
+    size_t length;
+};
+
+#define PODMAP_INITIAL_CAPACITY 16
+#define PODMAP_ALIGN 8
+
+static size_t round_up(size_t x, size_t to) {
+    return (x + to - 1) / to * to;
+}
+
+static uint64_t mix64(uint64_t x) {
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    x ^= x >> 33;
+    return x;
+}
+
+uint64_t podmap_hash(const void* key, size_t key_size) {
+    const unsigned char* p = key;
+    uint64_t h = 0x9e3779b97f4a7c15ULL ^ key_size;
+    size_t n = key_size;
+    while (n >= 8) {
+        uint64_t w;
+        memcpy(&w, p, 8);
+        h = mix64(h ^ w);
+        p += 8;
+        n -= 8;
+    }
+    if (n > 0) {
+        uint64_t w = 0;
+        memcpy(&w, p, n);
+        h = mix64(h ^ w);
+    }
+    return h;
+}
+
+static uint64_t slot_hash(const podmap* m, const void* key) {
+    const uint64_t h = podmap_hash(key, m->key_size);
+    return h ? h : 1; // 0 marks an empty slot
+}
+
+static unsigned char* slot_at(const podmap* m, size_t i) {
+    return m->slots + i * m->stride;
+}
+
+static void alloc_table(podmap* m, size_t capacity) {
+    m->hashes = calloc(capacity, sizeof(uint64_t));
+    m->slots = malloc(capacity * m->stride);
+    if (!m->hashes || !m->slots) {
+        fprintf(stderr, "podmap: out of memory\n");
+        abort();
+    }
+    m->capacity = capacity;
+}
+
+podmap* podmap_new(size_t key_size, size_t value_size) {
+    podmap* m = malloc(sizeof(podmap));
+    if (!m) {
+        fprintf(stderr, "podmap_new: out of memory\n");
+        abort();
+    }
+    m->key_size = key_size;
+    m->value_size = value_size;
+    m->value_offset = round_up(key_size, PODMAP_ALIGN);
+    m->stride = round_up(m->value_offset + value_size, PODMAP_ALIGN);
+    if (m->stride == 0) m->stride = PODMAP_ALIGN;
+    m->length = 0;
+    alloc_table(m, PODMAP_INITIAL_CAPACITY);
+    return m;
+}
+
+void podmap_free(podmap* m) {
+    if (!m) return;
+    free(m->hashes);
+    free(m->slots);
+    free(m);
+}
+
+/* Index of key's slot, or capacity if absent. */
+static size_t find_index(const podmap* m, const void* key, uint64_t h) {
+    const size_t mask = m->capacity - 1;
+    size_t i = (size_t)h & mask;
+    while (m->hashes[i] != 0) {
+        if (m->hashes[i] == h && memcmp(slot_at(m, i), key, m->key_size) == 0) {
+            return i;
+        }
+        i = (i + 1) & mask;
+    }
+    return m->capacity;
+}
+
+static void rehash(podmap* m, size_t new_capacity) {
+    uint64_t* old_hashes = m->hashes;
+    unsigned char* old_slots = m->slots;
+    const size_t old_capacity = m->capacity;
+
+    alloc_table(m, new_capacity);
+    const size_t mask = new_capacity - 1;
+    for (size_t i = 0; i < old_capacity; i++) {
+        const uint64_t h = old_hashes[i];
+        if (h == 0) continue;
+        size_t j = (size_t)h & mask;
+        while (m->hashes[j] != 0) {
+            j = (j + 1) & mask;
+        }
+        m->hashes[j] = h;
+        memcpy(slot_at(m, j), old_slots + i * m->stride, m->stride);
+    }
+
+    free(old_hashes);
+    free(old_slots);
+}
+
+/* Smallest power-of-two capacity that holds n keys under 3/4 load. */
+static size_t capacity_for(size_t n) {
+    size_t cap = PODMAP_INITIAL_CAPACITY;
+    while (cap / 4 * 3 < n) {
+        cap *= 2;
+    }
+    return cap;
+}
+
+void podmap_reserve(podmap* m, size_t n) {
+    if (!m) return;
+    const size_t cap = capacity_for(n);
+    if (cap > m->capacity) {
+        rehash(m, cap);
+    }
+}
+
+void* podmap_get(podmap* m, const void* key) {
+    if (!m) return NULL;
+    const size_t i = find_index(m, key, slot_hash(m, key));
+    if (i == m->capacity) return NULL;
+    return slot_at(m, i) + m->value_offset;
+}
+
+bool podmap_contains(podmap* m, const void* key) {
+    return podmap_get(m, key) != NULL;
+}
+
+void* podmap_put(podmap* m, const void* key, const void* value, bool* inserted) {
+    if (!m) return NULL;
+    if (m->length + 1 > m->capacity / 4 * 3) {
+        rehash(m, m->capacity * 2);
+    }
+
+    const uint64_t h = slot_hash(m, key);
+    const size_t mask = m->capacity - 1;
+    size_t i = (size_t)h & mask;
+    bool is_new = true;
+    while (m->hashes[i] != 0) {
+        if (m->hashes[i] == h && memcmp(slot_at(m, i), key, m->key_size) == 0) {
+            is_new = false;
+            break;
+        }
+        i = (i + 1) & mask;
+    }
+
+    unsigned char* slot = slot_at(m, i);
+    if (is_new) {
+        m->hashes[i] = h;
+        memcpy(slot, key, m->key_size);
+        if (!value) memset(slot + m->value_offset, 0, m->value_size);
+        m->length++;
+    }
+    if (value) memcpy(slot + m->value_offset, value, m->value_size);
+    if (inserted) *inserted = is_new;
+    return slot + m->value_offset;
+}
+
+bool podmap_add(podmap* m, const void* key) {
+    bool inserted = false;
+    podmap_put(m, key, NULL, &inserted);
+    return inserted;
+}
+
+bool podmap_remove(podmap* m, const void* key, void* out_value) {
+    if (!m) return false;
+    size_t i = find_index(m, key, slot_hash(m, key));
+    if (i == m->capacity) return false;
+    if (out_value) memcpy(out_value, slot_at(m, i) + m->value_offset, m->value_size);
+
+    // Backward shift: pull later entries of the cluster into the hole when
+    // the hole lies on their probe path, so no tombstone is needed.
+    const size_t mask = m->capacity - 1;
+    size_t j = i;
+    for (;;) {
+        j = (j + 1) & mask;
+        const uint64_t h = m->hashes[j];
+        if (h == 0) break;
+        const size_t home = (size_t)h & mask;
+        if (((j - home) & mask) >= ((j - i) & mask)) {
+            m->hashes[i] = h;
+            memcpy(slot_at(m, i), slot_at(m, j), m->stride);
+            i = j;
+        }
+    }
+    m->hashes[i] = 0;
+    m->length--;
+    return true;
+}
+
+void podmap_clear(podmap* m) {
+    if (!m) return;
+    memset(m->hashes, 0, m->capacity * sizeof(uint64_t));
+    m->length = 0;
+}
+
+size_t podmap_size(podmap* m) {
+    if (!m) return 0;
+    return m->length;
+}
+
+podmap_iter podmap_iterator(podmap* m) {
+    podmap_iter it;
+    it.key = NULL;
+    it.value = NULL;
+    it._map = m;
+    it._index = 0;
+    return it;
+}
+
+bool podmap_next(podmap_iter* it) {
+    if (!it || !it->_map) return false;
+    const podmap* m = it->_map;
+    while (it->_index < m->capacity) {
+        const size_t i = it->_index++;
+        if (m->hashes[i] != 0) {
+            unsigned char* slot = slot_at(m, i);
+            it->key = slot;
+            it->value = m->value_size ? slot + m->value_offset : NULL;
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,68 @@
+// podmap.h
+#ifndef PODMAP_H
+#define PODMAP_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Open-addressing hash map with fixed-size POD keys and values.
+ *
+ * Keys and values are copied by value (memcpy) and compared bytewise, so a
+ * struct key must not carry uninitialised padding. With value_size 0 the
+ * map is a set. Each slot stores its full 64-bit hash: probes compare that
+ * before touching the key, and growing never rehashes.
+ *
+ * Removal uses backward shifting rather than tombstones, so lookups stay
+ * short no matter how many keys have come and gone.
+ *
+ * Value pointers returned by podmap_get/podmap_put are valid until the next
+ * insert, remove, reserve or clear.
+ */
+typedef struct podmap podmap;
+
+podmap* podmap_new(size_t key_size, size_t value_size);
+void podmap_free(podmap* m);
+
+/* Returns a pointer to the value stored for key, or NULL if absent. */
+void* podmap_get(podmap* m, const void* key);
+bool podmap_contains(podmap* m, const void* key);
+
+/**
+ * Insert or overwrite. A NULL value zero-fills a new slot and leaves an
+ * existing one untouched. Returns the value slot (for sets, a non-NULL
+ * pointer that must not be dereferenced). *inserted, if given, tells
+ * whether the key was new.
+ */
+void* podmap_put(podmap* m, const void* key, const void* value, bool* inserted);
+
+/* Set-style insert: true if key was not present before. */
+bool podmap_add(podmap* m, const void* key);
+
+/* Copies the value to out_value (may be NULL) before removing. */
+bool podmap_remove(podmap* m, const void* key, void* out_value);
+
+/* Make room for n keys in total without further rehashing. */
+void podmap_reserve(podmap* m, size_t n);
+
+/* Drop all keys but keep the allocation. */
+void podmap_clear(podmap* m);
+
+size_t podmap_size(podmap* m);
+
+typedef struct {
+    const void* key;
+    void* value;
+
+    podmap* _map;
+    size_t _index;
+} podmap_iter;
+
+podmap_iter podmap_iterator(podmap* m);
+bool podmap_next(podmap_iter* it);
+
+/* The hash podmap uses for a key of the given size. */
+uint64_t podmap_hash(const void* key, size_t key_size);
+
+#endif
@@ -2,11 +2,20 @@
 #ifndef POINT_H
 #define POINT_H
 
+#include <assert.h>
+#include <stdint.h>
+
 typedef struct {
     int x;
     int y;
 } Point;
 
+typedef struct {
+    int x;
+    int y;
+    int z;
+} Point3;
+
 static const Point DIRS4[4] = {
     { 1, 0 },  // right
     {-1, 0 },  // left
@@ -19,4 +28,52 @@ static const Point DIRS8[8] = {
     { 1, 1}, { 1,-1}, {-1, 1}, {-1,-1}
 };
 
+/**
+ * Points packed into one integer key, for hashing and sorting without
+ * strings or padding. 2D keeps both int32 components (x high, y low);
+ * 3D keeps 21 bits per component, so |x|, |y|, |z| < 2^20.
+ */
+static inline uint64_t point_key(Point p) {
+    return ((uint64_t)(uint32_t)p.x << 32) | (uint32_t)p.y;
+}
+
+static inline Point point_from_key(uint64_t key) {
+    return (Point){ (int32_t)(uint32_t)(key >> 32), (int32_t)(uint32_t)key };
+}
+
+#define POINT3_BITS 21
+#define POINT3_MASK ((1u << POINT3_BITS) - 1)
+
+static inline uint64_t point3_key(Point3 p) {
+    assert(p.x >= -(1 << 20) && p.x < (1 << 20));
+    assert(p.y >= -(1 << 20) && p.y < (1 << 20));
+    assert(p.z >= -(1 << 20) && p.z < (1 << 20));
+    return ((uint64_t)((uint32_t)p.x & POINT3_MASK) << (2 * POINT3_BITS))
+           | ((uint64_t)((uint32_t)p.y & POINT3_MASK) << POINT3_BITS)
+           | ((uint32_t)p.z & POINT3_MASK);
+}
+
+/* Sign-extend a 21-bit field. */
+static inline int point3_field(uint64_t key, int shift) {
+    const uint32_t v = (uint32_t)(key >> shift) & POINT3_MASK;
+    return (int)(v ^ (1u << (POINT3_BITS - 1))) - (1 << (POINT3_BITS - 1));
+}
+
+static inline Point3 point3_from_key(uint64_t key) {
+    return (Point3){ point3_field(key, 2 * POINT3_BITS),
+                     point3_field(key, POINT3_BITS),
+                     point3_field(key, 0) };
+}
+
+/* Murmur3's 64-bit finaliser, as numset uses: neighbouring keys land far
+ * apart. For tables of your own keyed by point_key. */
+static inline uint64_t point_key_hash(uint64_t key) {
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+    key *= 0xc4ceb9fe1a85ec53ULL;
+    key ^= key >> 33;
+    return key;
+}
+
 #endif
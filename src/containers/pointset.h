@@ -0,0 +1,144 @@
+// pointset.h
+#ifndef POINTSET_H
+#define POINTSET_H
+
+/**
+ * Sets and maps of points, keyed by point_key/point3_key (point.h).
+ *
+ * pointset is a numset of packed keys and pointmap a podmap with 8-byte
+ * keys, so membership is one integer hash and probe: no "x,y" strings.
+ * A set or map holds either 2D or 3D points; the *3 functions take
+ * Point3. Anything numset/podmap can do (reserve, iterate, ...) works on
+ * them directly.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "numset.h"
+#include "podmap.h"
+#include "point.h"
+
+typedef struct numset pointset;
+typedef struct podmap pointmap;
+
+// ---- set ---------------------------------------------------------------------
+
+static inline pointset* pointset_new(void) {
+    return numset_new();
+}
+
+static inline void pointset_free(pointset* s) {
+    numset_free(s);
+}
+
+static inline size_t pointset_size(pointset* s) {
+    return numset_size(s);
+}
+
+static inline void pointset_clear(pointset* s) {
+    numset_clear(s);
+}
+
+/* True if p was not in the set. */
+static inline bool pointset_add(pointset* s, Point p) {
+    return numset_add(s, (long long)point_key(p));
+}
+
+static inline bool pointset_contains(pointset* s, Point p) {
+    return numset_contains(s, (long long)point_key(p));
+}
+
+static inline bool pointset_remove(pointset* s, Point p) {
+    return numset_remove(s, (long long)point_key(p));
+}
+
+static inline bool pointset_add3(pointset* s, Point3 p) {
+    return numset_add(s, (long long)point3_key(p));
+}
+
+static inline bool pointset_contains3(pointset* s, Point3 p) {
+    return numset_contains(s, (long long)point3_key(p));
+}
+
+static inline bool pointset_remove3(pointset* s, Point3 p) {
+    return numset_remove(s, (long long)point3_key(p));
+}
+
+/* Iterate with numset_iterator; these decode the next key. */
+static inline bool pointset_next(numset_iter* it, Point* out) {
+    long long key;
+    if (!numset_next(it, &key)) return false;
+    *out = point_from_key((uint64_t)key);
+    return true;
+}
+
+static inline bool pointset_next3(numset_iter* it, Point3* out) {
+    long long key;
+    if (!numset_next(it, &key)) return false;
+    *out = point3_from_key((uint64_t)key);
+    return true;
+}
+
+// ---- map ---------------------------------------------------------------------
+
+static inline pointmap* pointmap_new(size_t value_size) {
+    return podmap_new(sizeof(uint64_t), value_size);
+}
+
+static inline void pointmap_free(pointmap* m) {
+    podmap_free(m);
+}
+
+static inline size_t pointmap_size(pointmap* m) {
+    return podmap_size(m);
+}
+
+/* Value stored for p, or NULL. */
+static inline void* pointmap_get(pointmap* m, Point p) {
+    const uint64_t key = point_key(p);
+    return podmap_get(m, &key);
+}
+
+/* Insert or overwrite, as podmap_put. */
+static inline void* pointmap_put(pointmap* m, Point p, const void* value, bool* inserted) {
+    const uint64_t key = point_key(p);
+    return podmap_put(m, &key, value, inserted);
+}
+
+static inline bool pointmap_remove(pointmap* m, Point p, void* out_value) {
+    const uint64_t key = point_key(p);
+    return podmap_remove(m, &key, out_value);
+}
+
+static inline void* pointmap_get3(pointmap* m, Point3 p) {
+    const uint64_t key = point3_key(p);
+    return podmap_get(m, &key);
+}
+
+static inline void* pointmap_put3(pointmap* m, Point3 p, const void* value, bool* inserted) {
+    const uint64_t key = point3_key(p);
+    return podmap_put(m, &key, value, inserted);
+}
+
+static inline bool pointmap_remove3(pointmap* m, Point3 p, void* out_value) {
+    const uint64_t key = point3_key(p);
+    return podmap_remove(m, &key, out_value);
+}
+
+/* Point of the entry a podmap_iter is on. */
+static inline Point pointmap_iter_point(const podmap_iter* it) {
+    uint64_t key;
+    memcpy(&key, it->key, sizeof(key));
+    return point_from_key(key);
+}
+
+static inline Point3 pointmap_iter_point3(const podmap_iter* it) {
+    uint64_t key;
+    memcpy(&key, it->key, sizeof(key));
+    return point3_from_key(key);
+}
+
+#endif
@@ -0,0 +1,301 @@
+// pq.h
+#ifndef PQ_H
+#define PQ_H
+
+/**
+ * Priority queues, generated by macro. Both are 4-ary heaps: half the
+ * depth of a binary heap, and the four children of a node are adjacent,
+ * so a sift-down step touches one or two cache lines instead of four.
+ *
+ *   PQ_DEFINE(edge, Edge, EDGE_LESS)
+ *
+ * defines `pq_edge`, a heap of Edge values where LESS(a, b) means a comes
+ * out first, with inline pq_edge_init/free/reserve/clear/len/empty/push/
+ * top/pop/replace_top/push_bounded/drain. Key and payload are whatever
+ * the element type carries; LESS is expanded inline like VEC_DEFINE_SORT.
+ *
+ * push_bounded(q, item, k) keeps only the k items that would come out
+ * last: with LESS = "greater" the heap holds the k smallest seen so far
+ * and its top is the current cut-off.
+ *
+ * pq_edge_sift_up(a, i) and pq_edge_sift_down(a, n, i, x) work on any
+ * Edge array, for heaps that live in a fixed buffer.
+ *
+ *   IPQ_DEFINE(dist, uint64_t, PQ_LESS_SCALAR)
+ *
+ * defines `ipq_dist`, an indexed heap over ids 0..n-1 with one key each:
+ * push, decrease (key moves towards the top), push_or_decrease (the
+ * Dijkstra/Prim relax step), contains, key, top, pop. Each id is in the
+ * heap at most once, so the heap never grows past n.
+ *
+ * Like vec_X the structs are values: init before use, free after.
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define PQ_INITIAL_CAP 16
+#define PQ_ARITY 4
+
+#define PQ_LESS_SCALAR(a, b) ((a) < (b))
+
+#define PQ_DEFINE(name, T, LESS)                                                   \
+    typedef struct {                                                               \
+        size_t len;                                                                \
+        size_t cap;                                                                \
+        T* data;                                                                   \
+    } pq_##name;                                                                   \
+                                                                                   \
+    static inline void pq_##name##_init(pq_##name* q) {                            \
+        q->len = 0;                                                                \
+        q->cap = 0;                                                                \
+        q->data = NULL;                                                            \
+    }                                                                              \
+                                                                                   \
+    static inline void pq_##name##_free(pq_##name* q) {                            \
+        if (!q) return;                                                            \
+        free(q->data);                                                             \
+        pq_##name##_init(q);                                                       \
+    }                                                                              \
+                                                                                   \
+    static inline void pq_##name##_reserve(pq_##name* q, size_t min_cap) {         \
+        if (q->cap >= min_cap) return;                                             \
+        size_t new_cap = q->cap ? q->cap : PQ_INITIAL_CAP;                         \
+        while (new_cap < min_cap) new_cap *= 2;                                    \
+        T* data = (T*)realloc(q->data, new_cap * sizeof(T));                       \
+        if (!data) {                                                               \
+            fprintf(stderr, "pq_" #name "_reserve: out of memory\n");              \
+            abort();                                                               \
+        }                                                                          \
+        q->data = data;                                                            \
+        q->cap = new_cap;                                                          \
+    }                                                                              \
+                                                                                   \
+    static inline void pq_##name##_clear(pq_##name* q) {                           \
+        q->len = 0;                                                                \
+    }                                                                              \
+                                                                                   \
+    static inline size_t pq_##name##_len(const pq_##name* q) {                     \
+        return q->len;                                                             \
+    }                                                                              \
+                                                                                   \
+    static inline bool pq_##name##_empty(const pq_##name* q) {                     \
+        return q->len == 0;                                                        \
+    }                                                                              \
+                                                                                   \
+    static inline void pq_##name##_sift_up(T* a, size_t i) {                       \
+        const T x = a[i];                                                          \
+        while (i > 0) {                                                            \
+            const size_t parent = (i - 1) / PQ_ARITY;                              \
+            if (!(LESS(x, a[parent]))) break;                                      \
+            a[i] = a[parent];                                                      \
+            i = parent;                                                            \
+        }                                                                          \
+        a[i] = x;                                                                  \
+    }                                                                              \
+                                                                                   \
+    /* Sink x from slot i; a[i] itself is treated as a hole. */                    \
+    static inline void pq_##name##_sift_down(T* a, size_t n, size_t i, T x) {      \
+        for (;;) {                                                                 \
+            const size_t first = i * PQ_ARITY + 1;                                 \
+            if (first >= n) break;                                                 \
+            const size_t last = first + PQ_ARITY < n ? first + PQ_ARITY : n;       \
+            size_t best = first;                                                   \
+            for (size_t c = first + 1; c < last; c++) {                            \
+                if (LESS(a[c], a[best])) best = c;                                 \
+            }                                                                      \
+            if (!(LESS(a[best], x))) break;                                        \
+            a[i] = a[best];                                                        \
+            i = best;                                                              \
+        }                                                                          \
+        a[i] = x;                                                                  \
+    }                                                                              \
+                                                                                   \
+    static inline void pq_##name##_push(pq_##name* q, T item) {                    \
+        if (q->len == q->cap) pq_##name##_reserve(q, q->len + 1);                  \
+        q->data[q->len] = item;                                                    \
+        pq_##name##_sift_up(q->data, q->len++);                                    \
+    }                                                                              \
+                                                                                   \
+    static inline T* pq_##name##_top(pq_##name* q) {                               \
+        assert(q->len > 0);                                                        \
+        return &q->data[0];                                                        \
+    }                                                                              \
+                                                                                   \
+    static inline T pq_##name##_pop(pq_##name* q) {                                \
+        assert(q->len > 0);                                                        \
+        const T top = q->data[0];                                                  \
+        if (--q->len > 0) {                                                        \
+            pq_##name##_sift_down(q->data, q->len, 0, q->data[q->len]);            \
+        }                                                                          \
+        return top;                                                                \
+    }                                                                              \
+                                                                                   \
+    /* pop followed by push, with a single sift. */                                \
+    static inline T pq_##name##_replace_top(pq_##name* q, T item) {                \
+        assert(q->len > 0);                                                        \
+        const T top = q->data[0];                                                  \
+        pq_##name##_sift_down(q->data, q->len, 0, item);                           \
+        return top;                                                                \
+    }                                                                              \
+                                                                                   \
+    /* Keep the k items that come out last; false if item was dropped. */          \
+    static inline bool pq_##name##_push_bounded(pq_##name* q, T item, size_t k) {  \
+        if (q->len < k) {                                                          \
+            pq_##name##_push(q, item);                                             \
+            return true;                                                           \
+        }                                                                          \
+        if (k == 0 || !(LESS(q->data[0], item))) return false;                     \
+        pq_##name##_sift_down(q->data, q->len, 0, item);                           \
+        return true;                                                               \
+    }                                                                              \
+                                                                                   \
+    /* Pop everything into out (room for len items), in pop order. */             \
+    static inline size_t pq_##name##_drain(pq_##name* q, T* out) {                 \
+        const size_t n = q->len;                                                   \
+        for (size_t i = 0; i < n; i++) out[i] = pq_##name##_pop(q);                \
+        return n;                                                                  \
+    }
+
+#define IPQ_ABSENT UINT32_MAX
+
+#define IPQ_DEFINE(name, K, LESS)                                                  \
+    typedef struct {                                                               \
+        size_t len;                                                                \
+        size_t n;        /* ids are 0..n-1 */                                      \
+        uint32_t* heap;  /* ids in heap order */                                   \
+        uint32_t* pos;   /* id -> heap slot, or IPQ_ABSENT */                      \
+        K* keys;         /* id -> key */                                           \
+    } ipq_##name;                                                                  \
+                                                                                   \
+    static inline void ipq_##name##_init(ipq_##name* q, size_t n) {                \
+        assert(n < IPQ_ABSENT);                                                    \
+        q->len = 0;                                                                \
+        q->n = n;                                                                  \
+        q->heap = (uint32_t*)malloc((n ? n : 1) * sizeof(uint32_t));               \
+        q->pos = (uint32_t*)malloc((n ? n : 1) * sizeof(uint32_t));                \
+        q->keys = (K*)malloc((n ? n : 1) * sizeof(K));                             \
+        if (!q->heap || !q->pos || !q->keys) {                                     \
+            fprintf(stderr, "ipq_" #name "_init: out of memory\n");                \
+            abort();                                                               \
+        }                                                                          \
+        memset(q->pos, 0xff, n * sizeof(uint32_t));                                \
+    }                                                                              \
+                                                                                   \
+    static inline void ipq_##name##_free(ipq_##name* q) {                          \
+        if (!q) return;                                                            \
+        free(q->heap);                                                             \
+        free(q->pos);                                                              \
+        free(q->keys);                                                             \
+        q->heap = q->pos = NULL;                                                   \
+        q->keys = NULL;                                                            \
+        q->len = q->n = 0;                                                         \
+    }                                                                              \
+                                                                                   \
+    /* O(len), not O(n). */                                                        \
+    static inline void ipq_##name##_clear(ipq_##name* q) {                         \
+        for (size_t i = 0; i < q->len; i++) q->pos[q->heap[i]] = IPQ_ABSENT;       \
+        q->len = 0;                                                                \
+    }                                                                              \
+                                                                                   \
+    static inline size_t ipq_##name##_len(const ipq_##name* q) {                   \
+        return q->len;                                                             \
+    }                                                                              \
+                                                                                   \
+    static inline bool ipq_##name##_empty(const ipq_##name* q) {                   \
+        return q->len == 0;                                                        \
+    }                                                                              \
+                                                                                   \
+    static inline bool ipq_##name##_contains(const ipq_##name* q, uint32_t id) {   \
+        assert(id < q->n);                                                         \
+        return q->pos[id] != IPQ_ABSENT;                                           \
+    }                                                                              \
+                                                                                   \
+    /* Key of an id that is (or was last) in the heap. */                          \
+    static inline K ipq_##name##_key(const ipq_##name* q, uint32_t id) {           \
+        assert(id < q->n);                                                         \
+        return q->keys[id];                                                        \
+    }                                                                              \
+                                                                                   \
+    static inline void ipq_##name##_sift_up(ipq_##name* q, size_t i) {             \
+        const uint32_t id = q->heap[i];                                            \
+        const K key = q->keys[id];                                                 \
+        while (i > 0) {                                                            \
+            const size_t parent = (i - 1) / PQ_ARITY;                              \
+            const uint32_t pid = q->heap[parent];                                  \
+            if (!(LESS(key, q->keys[pid]))) break;                                 \
+            q->heap[i] = pid;                                                      \
+            q->pos[pid] = (uint32_t)i;                                             \
+            i = parent;                                                            \
+        }                                                                          \
+        q->heap[i] = id;                                                           \
+        q->pos[id] = (uint32_t)i;                                                  \
+    }                                                                              \
+                                                                                   \
+    static inline void ipq_##name##_sift_down(ipq_##name* q, size_t i, uint32_t id) { \
+        const K key = q->keys[id];                                                 \
+        for (;;) {                                                                 \
+            const size_t first = i * PQ_ARITY + 1;                                 \
+            if (first >= q->len) break;                                            \
+            const size_t last = first + PQ_ARITY < q->len ? first + PQ_ARITY : q->len; \
+            size_t best = first;                                                   \
+            for (size_t c = first + 1; c < last; c++) {                            \
+                if (LESS(q->keys[q->heap[c]], q->keys[q->heap[best]])) best = c;   \
+            }                                                                      \
+            const uint32_t bid = q->heap[best];                                    \
+            if (!(LESS(q->keys[bid], key))) break;                                 \
+            q->heap[i] = bid;                                                      \
+            q->pos[bid] = (uint32_t)i;                                             \
+            i = best;                                                              \
+        }                                                                          \
+        q->heap[i] = id;                                                           \
+        q->pos[id] = (uint32_t)i;                                                  \
+    }                                                                              \
+                                                                                   \
+    static inline void ipq_##name##_push(ipq_##name* q, uint32_t id, K key) {      \
+        assert(!ipq_##name##_contains(q, id));                                     \
+        q->keys[id] = key;                                                         \
+        q->heap[q->len] = id;                                                      \
+        ipq_##name##_sift_up(q, q->len++);                                         \
+    }                                                                              \
+                                                                                   \
+    /* key must not come after the id's current key. */                            \
+    static inline void ipq_##name##_decrease(ipq_##name* q, uint32_t id, K key) {  \
+        assert(ipq_##name##_contains(q, id));                                      \
+        assert(!(LESS(q->keys[id], key)));                                         \
+        q->keys[id] = key;                                                         \
+        ipq_##name##_sift_up(q, q->pos[id]);                                       \
+    }                                                                              \
+                                                                                   \
+    /* Insert id, or lower its key if key is better; true if anything changed. */ \
+    static inline bool ipq_##name##_push_or_decrease(ipq_##name* q, uint32_t id, K key) { \
+        if (!ipq_##name##_contains(q, id)) {                                       \
+            ipq_##name##_push(q, id, key);                                         \
+            return true;                                                           \
+        }                                                                          \
+        if (!(LESS(key, q->keys[id]))) return false;                               \
+        q->keys[id] = key;                                                         \
+        ipq_##name##_sift_up(q, q->pos[id]);                                       \
+        return true;                                                               \
+    }                                                                              \
+                                                                                   \
+    static inline uint32_t ipq_##name##_top(const ipq_##name* q) {                 \
+        assert(q->len > 0);                                                        \
+        return q->heap[0];                                                         \
+    }                                                                              \
+                                                                                   \
+    /* Remove the top id and return it; its key stays readable via key(). */      \
+    static inline uint32_t ipq_##name##_pop(ipq_##name* q) {                       \
+        assert(q->len > 0);                                                        \
+        const uint32_t top = q->heap[0];                                           \
+        q->pos[top] = IPQ_ABSENT;                                                  \
+        if (--q->len > 0) ipq_##name##_sift_down(q, 0, q->heap[q->len]);           \
+        return top;                                                                \
+    }
+
+#endif
@@ -2,10 +2,11 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 
 struct queue {
     void** data;
-    size_t cap;
+    size_t cap; // power of two, so wrapping is a mask
     size_t len;
     size_t head;
     size_t tail;
@@ -28,10 +29,10 @@ static void queue_ensure_capacity(queue* q, size_t min_cap) {
         abort();
     }
 
-    for (size_t i = 0; i < q->len; i++) {
-        const size_t idx = (q->head + i) % q->cap;
-        new_data[i] = q->data[idx];
-    }
+    // Unroll [head, cap) then [0, tail) to the front of the new block.
+    const size_t first = q->len < q->cap - q->head ? q->len : q->cap - q->head;
+    if (first) memcpy(new_data, q->data + q->head, first * sizeof(void*));
+    if (q->len > first) memcpy(new_data + first, q->data, (q->len - first) * sizeof(void*));
 
     free(q->data);
     q->data = new_data;
@@ -71,7 +72,7 @@ void queue_push(queue* q, void* item) {
     }
 
     q->data[q->tail] = item;
-    q->tail = (q->tail + 1) % q->cap;
+    q->tail = (q->tail + 1) & (q->cap - 1);
     q->len++;
 }
 
@@ -80,7 +81,7 @@ void* queue_pop(queue* q) {
     if (q->len == 0) return NULL;
 
     void* item = q->data[q->head];
-    q->head = (q->head + 1) % q->cap;
+    q->head = (q->head + 1) & (q->cap - 1);
     q->len--;
     return item;
 }
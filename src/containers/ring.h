@@ -0,0 +1,133 @@
+// ring.h
+#ifndef RING_H
+#define RING_H
+
+/**
+ * Type-specialised FIFO ring buffers, generated by macro.
+ *
+ *   RING_DEFINE(cell, int32_t)
+ *
+ * defines `ring_cell` and inline functions ring_cell_init/free/reserve/
+ * clear/len/empty/push/pop/front/peek/push_many/pop_many. Capacity is a
+ * power of two, so wrapping is a mask rather than a modulo, and growth
+ * unrolls the ring with at most two memcpys. push_many/pop_many move
+ * whole spans the same way.
+ *
+ * Like vec_X (typed_vec.h) the struct is a value: init before use, free
+ * after. pop/front/peek don't check emptiness beyond an assert.
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define RING_INITIAL_CAP 16
+
+#define RING_DEFINE(name, T)                                                       \
+    typedef struct {                                                               \
+        T* data;                                                                   \
+        size_t cap;  /* 0 or a power of two */                                     \
+        size_t head; /* index of the front element */                              \
+        size_t len;                                                                \
+    } ring_##name;                                                                 \
+                                                                                   \
+    static inline void ring_##name##_init(ring_##name* r) {                        \
+        r->data = NULL;                                                            \
+        r->cap = 0;                                                                \
+        r->head = 0;                                                               \
+        r->len = 0;                                                                \
+    }                                                                              \
+                                                                                   \
+    static inline void ring_##name##_free(ring_##name* r) {                        \
+        if (!r) return;                                                            \
+        free(r->data);                                                             \
+        ring_##name##_init(r);                                                     \
+    }                                                                              \
+                                                                                   \
+    static inline void ring_##name##_reserve(ring_##name* r, size_t min_cap) {     \
+        if (r->cap >= min_cap) return;                                             \
+        size_t new_cap = r->cap ? r->cap : RING_INITIAL_CAP;                       \
+        while (new_cap < min_cap) new_cap *= 2;                                    \
+        T* data = (T*)malloc(new_cap * sizeof(T));                                 \
+        if (!data) {                                                               \
+            fprintf(stderr, "ring_" #name "_reserve: out of memory\n");            \
+            abort();                                                               \
+        }                                                                          \
+        /* Unroll [head, end) then [0, tail) to the front of the new block. */     \
+        const size_t first = r->len < r->cap - r->head ? r->len : r->cap - r->head; \
+        if (first) memcpy(data, r->data + r->head, first * sizeof(T));             \
+        if (r->len > first) memcpy(data + first, r->data, (r->len - first) * sizeof(T)); \
+        free(r->data);                                                             \
+        r->data = data;                                                            \
+        r->cap = new_cap;                                                          \
+        r->head = 0;                                                               \
+    }                                                                              \
+                                                                                   \
+    static inline void ring_##name##_clear(ring_##name* r) {                       \
+        r->head = 0;                                                               \
+        r->len = 0;                                                                \
+    }                                                                              \
+                                                                                   \
+    static inline size_t ring_##name##_len(const ring_##name* r) {                 \
+        return r->len;                                                             \
+    }                                                                              \
+                                                                                   \
+    static inline bool ring_##name##_empty(const ring_##name* r) {                 \
+        return r->len == 0;                                                        \
+    }                                                                              \
+                                                                                   \
+    static inline void ring_##name##_push(ring_##name* r, T item) {                \
+        if (r->len == r->cap) ring_##name##_reserve(r, r->len + 1);                \
+        r->data[(r->head + r->len) & (r->cap - 1)] = item;                         \
+        r->len++;                                                                  \
+    }                                                                              \
+                                                                                   \
+    static inline T ring_##name##_pop(ring_##name* r) {                            \
+        assert(r->len > 0);                                                        \
+        const T item = r->data[r->head];                                           \
+        r->head = (r->head + 1) & (r->cap - 1);                                    \
+        r->len--;                                                                  \
+        return item;                                                               \
+    }                                                                              \
+                                                                                   \
+    static inline T* ring_##name##_front(ring_##name* r) {                         \
+        assert(r->len > 0);                                                        \
+        return &r->data[r->head];                                                  \
+    }                                                                              \
+                                                                                   \
+    /* i-th element from the front. */                                             \
+    static inline T* ring_##name##_peek(ring_##name* r, size_t i) {                \
+        assert(i < r->len);                                                        \
+        return &r->data[(r->head + i) & (r->cap - 1)];                             \
+    }                                                                              \
+                                                                                   \
+    static inline void ring_##name##_push_many(ring_##name* r, const T* items, size_t n) { \
+        if (n == 0) return;                                                        \
+        ring_##name##_reserve(r, r->len + n);                                      \
+        const size_t tail = (r->head + r->len) & (r->cap - 1);                     \
+        const size_t first = n < r->cap - tail ? n : r->cap - tail;                \
+        memcpy(r->data + tail, items, first * sizeof(T));                          \
+        if (n > first) memcpy(r->data, items + first, (n - first) * sizeof(T));    \
+        r->len += n;                                                               \
+    }                                                                              \
+                                                                                   \
+    /* Pop up to n elements into out; returns how many were popped. */             \
+    static inline size_t ring_##name##_pop_many(ring_##name* r, T* out, size_t n) { \
+        if (n > r->len) n = r->len;                                                \
+        if (n == 0) return 0;                                                      \
+        const size_t first = n < r->cap - r->head ? n : r->cap - r->head;          \
+        memcpy(out, r->data + r->head, first * sizeof(T));                         \
+        if (n > first) memcpy(out + first, r->data, (n - first) * sizeof(T));      \
+        r->head = (r->head + n) & (r->cap - 1);                                    \
+        r->len -= n;                                                               \
+        return n;                                                                  \
+    }
+
+RING_DEFINE(int32, int32_t)
+RING_DEFINE(uint32, uint32_t)
+
+#endif
@@ -0,0 +1,765 @@
+#include "roaring.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+enum { RB_ARRAY, RB_BITMAP, RB_RUN };
+
+#define RB_CHUNK_BITS 65536u
+#define RB_BITMAP_WORDS 1024u
+#define RB_BITMAP_BYTES (RB_BITMAP_WORDS * sizeof(uint64_t))
+#define RB_ARRAY_MAX 4096u // 2 bytes each: past this a bitmap is smaller
+#define RB_RUN_MAX 2048u   // 4 bytes each: past this a bitmap is smaller
+
+typedef struct {
+    uint16_t start;
+    uint16_t last; // inclusive
+} rb_run;
+
+typedef struct {
+    uint64_t key;  // value >> 16
+    int type;
+    uint32_t card; // values in the chunk, 1 .. 65536
+    uint32_t runs; // RB_RUN only
+    uint32_t cap;  // allocated array / run entries
+    union {
+        uint16_t* array; // card sorted offsets
+        uint64_t* bitmap;
+        rb_run* run;     // runs sorted, disjoint, non-adjacent
+    } d;
+} rb_chunk;
+
+struct roaring {
+    rb_chunk* chunks; // sorted by key
+    size_t n;
+    size_t cap;
+    size_t hint;      // last chunk touched; clustered inserts hit it again
+};
+
+static void* rb_alloc(size_t size) {
+    void* p = malloc(size ? size : 1);
+    if (!p) {
+        fprintf(stderr, "roaring: out of memory\n");
+        abort();
+    }
+    return p;
+}
+
+static void* rb_realloc(void* ptr, size_t size) {
+    void* p = realloc(ptr, size ? size : 1);
+    if (!p) {
+        fprintf(stderr, "roaring: out of memory\n");
+        abort();
+    }
+    return p;
+}
+
+// ---- bitmap words ------------------------------------------------------------
+
+/* Set bits lo..hi (inclusive). */
+static void words_set_range(uint64_t* w, uint32_t lo, uint32_t hi) {
+    const uint32_t first = lo >> 6;
+    const uint32_t last = hi >> 6;
+    const uint64_t first_mask = ~0ULL << (lo & 63);
+    const uint64_t last_mask = ~0ULL >> (63 - (hi & 63));
+    if (first == last) {
+        w[first] |= first_mask & last_mask;
+        return;
+    }
+    w[first] |= first_mask;
+    for (uint32_t i = first + 1; i < last; i++) {
+        w[i] = ~0ULL;
+    }
+    w[last] |= last_mask;
+}
+
+static uint32_t words_popcount(const uint64_t* w) {
+    uint32_t n = 0;
+    for (uint32_t i = 0; i < RB_BITMAP_WORDS; i++) {
+        n += (uint32_t)__builtin_popcountll(w[i]);
+    }
+    return n;
+}
+
+/* Number of maximal runs of set bits. */
+static uint32_t words_count_runs(const uint64_t* w) {
+    uint32_t runs = 0;
+    uint64_t carry = 0; // top bit of the previous word
+    for (uint32_t i = 0; i < RB_BITMAP_WORDS; i++) {
+        const uint64_t x = w[i];
+        runs += (uint32_t)__builtin_popcountll(x & ~((x << 1) | carry));
+        carry = x >> 63;
+    }
+    return runs;
+}
+
+/* First set (want = 1) or clear (want = 0) bit at or after from; 65536 if none. */
+static uint32_t words_next(const uint64_t* w, uint32_t from, int want) {
+    if (from >= RB_CHUNK_BITS) return RB_CHUNK_BITS;
+    uint32_t i = from >> 6;
+    uint64_t x = (want ? w[i] : ~w[i]) & (~0ULL << (from & 63));
+    for (;;) {
+        if (x) return (i << 6) + (uint32_t)__builtin_ctzll(x);
+        if (++i == RB_BITMAP_WORDS) return RB_CHUNK_BITS;
+        x = want ? w[i] : ~w[i];
+    }
+}
+
+// ---- chunks ------------------------------------------------------------------
+
+static void chunk_free(rb_chunk* c) {
+    free(c->d.array);
+    c->d.array = NULL;
+}
+
+static uint32_t array_lower_bound(const uint16_t* a, uint32_t n, uint32_t v) {
+    uint32_t lo = 0, hi = n;
+    while (lo < hi) {
+        const uint32_t mid = (lo + hi) / 2;
+        if (a[mid] < v) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+/* Number of runs whose start is <= v. */
+static uint32_t run_upper_bound(const rb_run* r, uint32_t n, uint32_t v) {
+    uint32_t lo = 0, hi = n;
+    while (lo < hi) {
+        const uint32_t mid = (lo + hi) / 2;
+        if (r[mid].start <= v) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+static void chunk_to_words(const rb_chunk* c, uint64_t* w) {
+    if (c->type == RB_BITMAP) {
+        memcpy(w, c->d.bitmap, RB_BITMAP_BYTES);
+        return;
+    }
+    memset(w, 0, RB_BITMAP_BYTES);
+    if (c->type == RB_ARRAY) {
+        for (uint32_t i = 0; i < c->card; i++) {
+            w[c->d.array[i] >> 6] |= 1ULL << (c->d.array[i] & 63);
+        }
+    } else {
+        for (uint32_t i = 0; i < c->runs; i++) {
+            words_set_range(w, c->d.run[i].start, c->d.run[i].last);
+        }
+    }
+}
+
+/* The chunk as bitmap words: its own bitmap, or filled into buf. */
+static const uint64_t* chunk_words(const rb_chunk* c, uint64_t* buf) {
+    if (c->type == RB_BITMAP) return c->d.bitmap;
+    chunk_to_words(c, buf);
+    return buf;
+}
+
+/* Replace the chunk's storage with a `type` copy of words (which may be the
+ * chunk's own bitmap). */
+static void chunk_build(rb_chunk* c, const uint64_t* w, uint32_t card, int type) {
+    void* old = c->d.array;
+
+    if (type == RB_BITMAP) {
+        c->d.bitmap = rb_alloc(RB_BITMAP_BYTES);
+        memcpy(c->d.bitmap, w, RB_BITMAP_BYTES);
+        c->cap = 0;
+    } else if (type == RB_ARRAY) {
+        uint16_t* a = rb_alloc(card * sizeof(uint16_t));
+        uint32_t n = 0;
+        for (uint32_t i = 0; i < RB_BITMAP_WORDS; i++) {
+            for (uint64_t x = w[i]; x; x &= x - 1) {
+                a[n++] = (uint16_t)((i << 6) + (uint32_t)__builtin_ctzll(x));
+            }
+        }
+        c->d.array = a;
+        c->cap = card;
+    } else {
+        const uint32_t runs = words_count_runs(w);
+        rb_run* r = rb_alloc(runs * sizeof(rb_run));
+        uint32_t n = 0;
+        for (uint32_t pos = words_next(w, 0, 1); pos < RB_CHUNK_BITS; ) {
+            const uint32_t end = words_next(w, pos, 0);
+            r[n].start = (uint16_t)pos;
+            r[n].last = (uint16_t)(end - 1);
+            n++;
+            pos = words_next(w, end, 1);
+        }
+        c->d.run = r;
+        c->runs = runs;
+        c->cap = runs;
+    }
+
+    c->type = type;
+    c->card = card;
+    free(old);
+}
+
+/* Array if small enough, bitmap otherwise. */
+static void chunk_build_default(rb_chunk* c, const uint64_t* w) {
+    const uint32_t card = words_popcount(w);
+    chunk_build(c, w, card, card <= RB_ARRAY_MAX ? RB_ARRAY : RB_BITMAP);
+}
+
+static void chunk_clone(rb_chunk* dst, const rb_chunk* src) {
+    *dst = *src;
+    size_t bytes;
+    if (src->type == RB_BITMAP) bytes = RB_BITMAP_BYTES;
+    else if (src->type == RB_ARRAY) bytes = src->card * sizeof(uint16_t);
+    else bytes = src->runs * sizeof(rb_run);
+    dst->d.array = rb_alloc(bytes);
+    memcpy(dst->d.array, src->d.array, bytes);
+    dst->cap = src->type == RB_ARRAY ? src->card : src->runs;
+}
+
+static bool chunk_contains(const rb_chunk* c, uint32_t low) {
+    switch (c->type) {
+    case RB_ARRAY: {
+        const uint32_t i = array_lower_bound(c->d.array, c->card, low);
+        return i < c->card && c->d.array[i] == low;
+    }
+    case RB_BITMAP:
+        return (c->d.bitmap[low >> 6] >> (low & 63)) & 1;
+    default: {
+        const uint32_t i = run_upper_bound(c->d.run, c->runs, low);
+        return i > 0 && low <= c->d.run[i - 1].last;
+    }
+    }
+}
+
+/* Merge [lo, hi] into a run chunk. */
+static void run_add_range(rb_chunk* c, uint32_t lo, uint32_t hi) {
+    rb_run* r = c->d.run;
+    // Runs first..last-1 overlap or touch [lo, hi] and fold into one.
+    uint32_t first = 0, last = c->runs;
+    {
+        uint32_t a = 0, b = c->runs;
+        while (a < b) {
+            const uint32_t mid = (a + b) / 2;
+            if ((uint32_t)r[mid].last + 1 < lo) a = mid + 1;
+            else b = mid;
+        }
+        first = a;
+    }
+    last = run_upper_bound(r, c->runs, hi + 1);
+
+    uint32_t start = lo, end = hi, covered = 0;
+    for (uint32_t i = first; i < last; i++) {
+        if (r[i].start < start) start = r[i].start;
+        if (r[i].last > end) end = r[i].last;
+        covered += (uint32_t)r[i].last - r[i].start + 1;
+    }
+
+    if (first == last) {
+        if (c->runs == c->cap) {
+            c->cap = c->cap ? c->cap * 2 : 4;
+            c->d.run = r = rb_realloc(r, c->cap * sizeof(rb_run));
+        }
+        memmove(&r[first + 1], &r[first], (c->runs - first) * sizeof(rb_run));
+        c->runs++;
+    } else {
+        memmove(&r[first + 1], &r[last], (c->runs - last) * sizeof(rb_run));
+        c->runs -= last - first - 1;
+    }
+    r[first].start = (uint16_t)start;
+    r[first].last = (uint16_t)end;
+    c->card += (end - start + 1) - covered;
+
+    if (c->runs > RB_RUN_MAX) {
+        uint64_t* w = rb_alloc(RB_BITMAP_BYTES);
+        chunk_to_words(c, w);
+        chunk_build(c, w, c->card, RB_BITMAP);
+        free(w);
+    }
+}
+
+static void chunk_add_range(rb_chunk* c, uint32_t lo, uint32_t hi) {
+    if (c->type == RB_RUN) {
+        run_add_range(c, lo, hi);
+        return;
+    }
+    if (c->type == RB_BITMAP) {
+        words_set_range(c->d.bitmap, lo, hi);
+        c->card = words_popcount(c->d.bitmap);
+        return;
+    }
+    uint64_t* w = rb_alloc(RB_BITMAP_BYTES);
+    chunk_to_words(c, w);
+    words_set_range(w, lo, hi);
+    chunk_build_default(c, w);
+    free(w);
+}
+
+static bool chunk_add(rb_chunk* c, uint32_t low) {
+    switch (c->type) {
+    case RB_ARRAY: {
+        const uint32_t i = array_lower_bound(c->d.array, c->card, low);
+        if (i < c->card && c->d.array[i] == low) return false;
+        if (c->card == RB_ARRAY_MAX) {
+            uint64_t* w = rb_alloc(RB_BITMAP_BYTES);
+            chunk_to_words(c, w);
+            w[low >> 6] |= 1ULL << (low & 63);
+            chunk_build(c, w, c->card + 1, RB_BITMAP);
+            free(w);
+            return true;
+        }
+        if (c->card == c->cap) {
+            c->cap = c->cap ? c->cap * 2 : 4;
+            if (c->cap > RB_ARRAY_MAX) c->cap = RB_ARRAY_MAX;
+            c->d.array = rb_realloc(c->d.array, c->cap * sizeof(uint16_t));
+        }
+        memmove(&c->d.array[i + 1], &c->d.array[i], (c->card - i) * sizeof(uint16_t));
+        c->d.array[i] = (uint16_t)low;
+        c->card++;
+        return true;
+    }
+    case RB_BITMAP: {
+        uint64_t* word = &c->d.bitmap[low >> 6];
+        const uint64_t bit = 1ULL << (low & 63);
+        if (*word & bit) return false;
+        *word |= bit;
+        c->card++;
+        return true;
+    }
+    default:
+        if (chunk_contains(c, low)) return false;
+        run_add_range(c, low, low);
+        return true;
+    }
+}
+
+static bool chunk_remove(rb_chunk* c, uint32_t low) {
+    switch (c->type) {
+    case RB_ARRAY: {
+        const uint32_t i = array_lower_bound(c->d.array, c->card, low);
+        if (i >= c->card || c->d.array[i] != low) return false;
+        memmove(&c->d.array[i], &c->d.array[i + 1], (c->card - i - 1) * sizeof(uint16_t));
+        c->card--;
+        return true;
+    }
+    case RB_BITMAP: {
+        uint64_t* word = &c->d.bitmap[low >> 6];
+        const uint64_t bit = 1ULL << (low & 63);
+        if (!(*word & bit)) return false;
+        *word &= ~bit;
+        c->card--;
+        // Convert well below the threshold so add/remove at the boundary
+        // doesn't flip representations every time.
+        if (c->card <= RB_ARRAY_MAX / 2) {
+            chunk_build(c, c->d.bitmap, c->card, RB_ARRAY);
+        }
+        return true;
+    }
+    default: {
+        const uint32_t i = run_upper_bound(c->d.run, c->runs, low);
+        if (i == 0 || low > c->d.run[i - 1].last) return false;
+        rb_run* r = &c->d.run[i - 1];
+        if (r->start == r->last) {
+            memmove(r, r + 1, (c->runs - i) * sizeof(rb_run));
+            c->runs--;
+        } else if (low == r->start) {
+            r->start++;
+        } else if (low == r->last) {
+            r->last--;
+        } else {
+            // Split in two.
+            const rb_run tail = { (uint16_t)(low + 1), r->last };
+            r->last = (uint16_t)(low - 1);
+            if (c->runs == c->cap) {
+                c->cap *= 2;
+                c->d.run = rb_realloc(c->d.run, c->cap * sizeof(rb_run));
+            }
+            memmove(&c->d.run[i + 1], &c->d.run[i], (c->runs - i) * sizeof(rb_run));
+            c->d.run[i] = tail;
+            c->runs++;
+        }
+        c->card--;
+        if (c->runs > RB_RUN_MAX) {
+            uint64_t* w = rb_alloc(RB_BITMAP_BYTES);
+            chunk_to_words(c, w);
+            chunk_build(c, w, c->card, RB_BITMAP);
+            free(w);
+        }
+        return true;
+    }
+    }
+}
+
+/* a |= b */
+static void chunk_union(rb_chunk* a, const rb_chunk* b) {
+    if (a->card == RB_CHUNK_BITS) return;
+    if (b->card == RB_CHUNK_BITS) {
+        chunk_free(a);
+        chunk_clone(a, b);
+        return;
+    }
+
+    if (a->type == RB_ARRAY && b->type == RB_ARRAY && a->card + b->card <= RB_ARRAY_MAX) {
+        const uint32_t cap = a->card + b->card;
+        uint16_t* out = rb_alloc(cap * sizeof(uint16_t));
+        uint32_t i = 0, j = 0, n = 0;
+        while (i < a->card && j < b->card) {
+            const uint16_t x = a->d.array[i], y = b->d.array[j];
+            out[n++] = x < y ? x : y;
+            i += x <= y;
+            j += y <= x;
+        }
+        while (i < a->card) out[n++] = a->d.array[i++];
+        while (j < b->card) out[n++] = b->d.array[j++];
+        free(a->d.array);
+        a->d.array = out;
+        a->card = n;
+        a->cap = cap;
+        return;
+    }
+
+    if (a->type == RB_RUN && b->type == RB_RUN) {
+        for (uint32_t i = 0; i < b->runs && a->type == RB_RUN; i++) {
+            run_add_range(a, b->d.run[i].start, b->d.run[i].last);
+        }
+        if (a->type == RB_RUN) return;
+    }
+
+    uint64_t* w = rb_alloc(RB_BITMAP_BYTES);
+    chunk_to_words(a, w);
+    if (b->type == RB_BITMAP) {
+        for (uint32_t i = 0; i < RB_BITMAP_WORDS; i++) w[i] |= b->d.bitmap[i];
+    } else if (b->type == RB_ARRAY) {
+        for (uint32_t i = 0; i < b->card; i++) {
+            w[b->d.array[i] >> 6] |= 1ULL << (b->d.array[i] & 63);
+        }
+    } else {
+        for (uint32_t i = 0; i < b->runs; i++) {
+            words_set_range(w, b->d.run[i].start, b->d.run[i].last);
+        }
+    }
+    chunk_build_default(a, w);
+    free(w);
+}
+
+/* a &= b. The result may be empty. */
+static void chunk_intersect(rb_chunk* a, const rb_chunk* b) {
+    if (a->type == RB_ARRAY) {
+        uint32_t n = 0;
+        for (uint32_t i = 0; i < a->card; i++) {
+            if (chunk_contains(b, a->d.array[i])) a->d.array[n++] = a->d.array[i];
+        }
+        a->card = n;
+        return;
+    }
+    if (b->type == RB_ARRAY) {
+        uint16_t* out = rb_alloc(b->card * sizeof(uint16_t));
+        uint32_t n = 0;
+        for (uint32_t i = 0; i < b->card; i++) {
+            if (chunk_contains(a, b->d.array[i])) out[n++] = b->d.array[i];
+        }
+        chunk_free(a);
+        a->type = RB_ARRAY;
+        a->d.array = out;
+        a->card = n;
+        a->cap = b->card;
+        return;
+    }
+
+    uint64_t buf[RB_BITMAP_WORDS];
+    const uint64_t* bw = chunk_words(b, buf);
+    uint64_t* w = rb_alloc(RB_BITMAP_BYTES);
+    chunk_to_words(a, w);
+    for (uint32_t i = 0; i < RB_BITMAP_WORDS; i++) w[i] &= bw[i];
+    chunk_build_default(a, w);
+    free(w);
+}
+
+static uint32_t chunk_intersect_card(const rb_chunk* a, const rb_chunk* b) {
+    if (a->type != RB_ARRAY && b->type == RB_ARRAY) {
+        const rb_chunk* t = a;
+        a = b;
+        b = t;
+    }
+    if (a->type == RB_ARRAY) {
+        uint32_t n = 0;
+        for (uint32_t i = 0; i < a->card; i++) {
+            n += chunk_contains(b, a->d.array[i]);
+        }
+        return n;
+    }
+    uint64_t abuf[RB_BITMAP_WORDS], bbuf[RB_BITMAP_WORDS];
+    const uint64_t* aw = chunk_words(a, abuf);
+    const uint64_t* bw = chunk_words(b, bbuf);
+    uint32_t n = 0;
+    for (uint32_t i = 0; i < RB_BITMAP_WORDS; i++) {
+        n += (uint32_t)__builtin_popcountll(aw[i] & bw[i]);
+    }
+    return n;
+}
+
+// ---- set ---------------------------------------------------------------------
+
+roaring* roaring_new(void) {
+    roaring* r = malloc(sizeof(roaring));
+    if (!r) {
+        fprintf(stderr, "roaring_new: out of memory\n");
+        abort();
+    }
+    r->chunks = NULL;
+    r->n = 0;
+    r->cap = 0;
+    r->hint = 0;
+    return r;
+}
+
+void roaring_free(roaring* r) {
+    if (!r) return;
+    for (size_t i = 0; i < r->n; i++) {
+        chunk_free(&r->chunks[i]);
+    }
+    free(r->chunks);
+    free(r);
+}
+
+/* Index of the first chunk with key >= key. */
+static size_t find_chunk(const roaring* r, uint64_t key) {
+    if (r->hint < r->n && r->chunks[r->hint].key == key) return r->hint;
+    size_t lo = 0, hi = r->n;
+    while (lo < hi) {
+        const size_t mid = lo + (hi - lo) / 2;
+        if (r->chunks[mid].key < key) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+static rb_chunk* get_chunk(const roaring* r, uint64_t key) {
+    const size_t i = find_chunk(r, key);
+    return (i < r->n && r->chunks[i].key == key) ? &r->chunks[i] : NULL;
+}
+
+/* Insert an empty chunk of the given type at index i. */
+static rb_chunk* insert_chunk(roaring* r, size_t i, uint64_t key, int type) {
+    if (r->n == r->cap) {
+        r->cap = r->cap ? r->cap * 2 : 8;
+        r->chunks = rb_realloc(r->chunks, r->cap * sizeof(rb_chunk));
+    }
+    memmove(&r->chunks[i + 1], &r->chunks[i], (r->n - i) * sizeof(rb_chunk));
+    r->n++;
+
+    rb_chunk* c = &r->chunks[i];
+    memset(c, 0, sizeof(*c));
+    c->key = key;
+    c->type = type;
+    return c;
+}
+
+static void remove_chunk(roaring* r, size_t i) {
+    chunk_free(&r->chunks[i]);
+    memmove(&r->chunks[i], &r->chunks[i + 1], (r->n - i - 1) * sizeof(rb_chunk));
+    r->n--;
+}
+
+bool roaring_add(roaring* r, uint64_t value) {
+    if (!r) return false;
+    const uint64_t key = value >> 16;
+    size_t i = find_chunk(r, key);
+    if (i == r->n || r->chunks[i].key != key) {
+        insert_chunk(r, i, key, RB_ARRAY);
+    }
+    r->hint = i;
+    return chunk_add(&r->chunks[i], (uint32_t)(value & 0xFFFF));
+}
+
+void roaring_add_range(roaring* r, uint64_t lo, uint64_t hi) {
+    if (!r || lo > hi) return;
+    const uint64_t first = lo >> 16;
+    const uint64_t last = hi >> 16;
+    for (uint64_t key = first; ; key++) {
+        const uint32_t clo = key == first ? (uint32_t)(lo & 0xFFFF) : 0;
+        const uint32_t chi = key == last ? (uint32_t)(hi & 0xFFFF) : 0xFFFF;
+
+        const size_t i = find_chunk(r, key);
+        if (i == r->n || r->chunks[i].key != key) {
+            // A fresh chunk for a range is a single run.
+            rb_chunk* c = insert_chunk(r, i, key, RB_RUN);
+            c->d.run = rb_alloc(sizeof(rb_run));
+            c->d.run[0].start = (uint16_t)clo;
+            c->d.run[0].last = (uint16_t)chi;
+            c->runs = 1;
+            c->cap = 1;
+            c->card = chi - clo + 1;
+        } else {
+            chunk_add_range(&r->chunks[i], clo, chi);
+        }
+        r->hint = i;
+        if (key == last) break;
+    }
+}
+
+bool roaring_remove(roaring* r, uint64_t value) {
+    if (!r) return false;
+    const uint64_t key = value >> 16;
+    const size_t i = find_chunk(r, key);
+    if (i == r->n || r->chunks[i].key != key) return false;
+    if (!chunk_remove(&r->chunks[i], (uint32_t)(value & 0xFFFF))) return false;
+    if (r->chunks[i].card == 0) remove_chunk(r, i);
+    return true;
+}
+
+bool roaring_contains(const roaring* r, uint64_t value) {
+    if (!r) return false;
+    const rb_chunk* c = get_chunk(r, value >> 16);
+    return c && chunk_contains(c, (uint32_t)(value & 0xFFFF));
+}
+
+uint64_t roaring_cardinality(const roaring* r) {
+    if (!r) return 0;
+    uint64_t n = 0;
+    for (size_t i = 0; i < r->n; i++) {
+        n += r->chunks[i].card;
+    }
+    return n;
+}
+
+void roaring_union_with(roaring* a, const roaring* b) {
+    if (!a || !b || b->n == 0) return;
+
+    rb_chunk* out = rb_alloc((a->n + b->n) * sizeof(rb_chunk));
+    size_t i = 0, j = 0, n = 0;
+    while (i < a->n || j < b->n) {
+        if (j == b->n || (i < a->n && a->chunks[i].key < b->chunks[j].key)) {
+            out[n++] = a->chunks[i++];
+        } else if (i == a->n || b->chunks[j].key < a->chunks[i].key) {
+            chunk_clone(&out[n++], &b->chunks[j++]);
+        } else {
+            out[n] = a->chunks[i++];
+            chunk_union(&out[n++], &b->chunks[j++]);
+        }
+    }
+
+    free(a->chunks);
+    a->cap = a->n + b->n;
+    a->chunks = out;
+    a->n = n;
+    a->hint = 0;
+}
+
+void roaring_intersect_with(roaring* a, const roaring* b) {
+    if (!a || !b) return;
+
+    size_t i = 0, j = 0, n = 0;
+    while (i < a->n) {
+        rb_chunk* c = &a->chunks[i++];
+        while (j < b->n && b->chunks[j].key < c->key) j++;
+        if (j < b->n && b->chunks[j].key == c->key) {
+            chunk_intersect(c, &b->chunks[j]);
+        } else {
+            c->card = 0;
+        }
+        if (c->card == 0) {
+            chunk_free(c);
+        } else {
+            a->chunks[n++] = *c;
+        }
+    }
+    a->n = n;
+    a->hint = 0;
+}
+
+uint64_t roaring_intersect_cardinality(const roaring* a, const roaring* b) {
+    if (!a || !b) return 0;
+    uint64_t n = 0;
+    size_t i = 0, j = 0;
+    while (i < a->n && j < b->n) {
+        if (a->chunks[i].key < b->chunks[j].key) {
+            i++;
+        } else if (b->chunks[j].key < a->chunks[i].key) {
+            j++;
+        } else {
+            n += chunk_intersect_card(&a->chunks[i++], &b->chunks[j++]);
+        }
+    }
+    return n;
+}
+
+void roaring_optimize(roaring* r) {
+    if (!r) return;
+    uint64_t buf[RB_BITMAP_WORDS];
+    for (size_t i = 0; i < r->n; i++) {
+        rb_chunk* c = &r->chunks[i];
+        const uint64_t* w = chunk_words(c, buf);
+        const size_t run_bytes = words_count_runs(w) * sizeof(rb_run);
+        const size_t array_bytes = c->card <= RB_ARRAY_MAX ? c->card * sizeof(uint16_t) : SIZE_MAX;
+
+        int best = RB_BITMAP;
+        size_t best_bytes = RB_BITMAP_BYTES;
+        if (array_bytes < best_bytes) {
+            best = RB_ARRAY;
+            best_bytes = array_bytes;
+        }
+        if (run_bytes < best_bytes) {
+            best = RB_RUN;
+        }
+        if (best != c->type) {
+            chunk_build(c, w, c->card, best);
+        } else if (c->cap > (c->type == RB_ARRAY ? c->card : c->runs)) {
+            chunk_build(c, w, c->card, best); // trim slack
+        }
+    }
+}
+
+size_t roaring_size_in_bytes(const roaring* r) {
+    if (!r) return 0;
+    size_t bytes = r->cap * sizeof(rb_chunk);
+    for (size_t i = 0; i < r->n; i++) {
+        const rb_chunk* c = &r->chunks[i];
+        if (c->type == RB_BITMAP) bytes += RB_BITMAP_BYTES;
+        else if (c->type == RB_ARRAY) bytes += c->cap * sizeof(uint16_t);
+        else bytes += c->cap * sizeof(rb_run);
+    }
+    return bytes;
+}
+
+roaring_iter roaring_iterator(const roaring* r) {
+    roaring_iter it;
+    it._set = r;
+    it._chunk = 0;
+    it._pos = 0;
+    it._offset = 0;
+    return it;
+}
+
+bool roaring_next(roaring_iter* it, uint64_t* out_value) {
+    if (!it || !it->_set || !out_value) return false;
+    const roaring* r = it->_set;
+
+    while (it->_chunk < r->n) {
+        const rb_chunk* c = &r->chunks[it->_chunk];
+        uint32_t low = RB_CHUNK_BITS;
+
+        if (c->type == RB_ARRAY) {
+            if (it->_pos < c->card) low = c->d.array[it->_pos++];
+        } else if (c->type == RB_BITMAP) {
+            low = words_next(c->d.bitmap, it->_pos, 1);
+            it->_pos = low + 1;
+        } else if (it->_pos < c->runs) {
+            const rb_run* run = &c->d.run[it->_pos];
+            low = run->start + it->_offset;
+            if (low == run->last) {
+                it->_pos++;
+                it->_offset = 0;
+            } else {
+                it->_offset++;
+            }
+        }
+
+        if (low < RB_CHUNK_BITS) {
+            *out_value = (c->key << 16) | low;
+            return true;
+        }
+        it->_chunk++;
+        it->_pos = 0;
+        it->_offset = 0;
+    }
+    return false;
+}
@@ -0,0 +1,64 @@
+// roaring.h
+#ifndef ROARING_H
+#define ROARING_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Compressed set of unsigned 64-bit integers (Roaring bitmap layout).
+ *
+ * Values are split into 2^16-wide chunks by their high 48 bits; each
+ * non-empty chunk is stored as whichever fits its contents:
+ *
+ *   array   sorted uint16 offsets      (sparse, up to 4096 values)
+ *   bitmap  65536 bits                 (dense)
+ *   run     sorted [start, last] pairs (long consecutive stretches)
+ *
+ * Clustered data (IDs, ranges, grid cell indices) costs a few bits per
+ * value instead of a hashed slot, and set algebra works chunk by chunk
+ * with word operations. Prefer numset for scattered values.
+ *
+ * Iteration is in ascending order.
+ */
+typedef struct roaring roaring;
+
+roaring* roaring_new(void);
+void roaring_free(roaring* r);
+
+/* True if value was not present before. */
+bool roaring_add(roaring* r, uint64_t value);
+
+/* Add every value in [lo, hi] (inclusive). */
+void roaring_add_range(roaring* r, uint64_t lo, uint64_t hi);
+
+bool roaring_remove(roaring* r, uint64_t value);
+bool roaring_contains(const roaring* r, uint64_t value);
+
+uint64_t roaring_cardinality(const roaring* r);
+
+/* a |= b, a &= b */
+void roaring_union_with(roaring* a, const roaring* b);
+void roaring_intersect_with(roaring* a, const roaring* b);
+
+/* |a & b| without building the intersection. */
+uint64_t roaring_intersect_cardinality(const roaring* a, const roaring* b);
+
+/* Re-pick each chunk's representation, preferring runs where smaller. */
+void roaring_optimize(roaring* r);
+
+/* Heap bytes used by the chunks. */
+size_t roaring_size_in_bytes(const roaring* r);
+
+typedef struct {
+    const roaring* _set;
+    size_t _chunk;
+    uint32_t _pos;
+    uint32_t _offset;
+} roaring_iter;
+
+roaring_iter roaring_iterator(const roaring* r);
+bool roaring_next(roaring_iter* it, uint64_t* out_value);
+
+#endif
@@ -20,6 +20,23 @@ set* set_new(void) {
     return s;
 }
 
+set* set_new_interned(intern_pool* pool) {
+    set* s = malloc(sizeof(set));
+    if (!s) {
+        fprintf(stderr, "set_new_interned: out of memory\n");
+        abort();
+    }
+
+    s->map = hm_create_interned(pool);
+    if (!s->map) {
+        fprintf(stderr, "set_new_interned: failed to create hashmap\n");
+        free(s);
+        abort();
+    }
+
+    return s;
+}
+
 void set_free(set* s) {
     if (!s) return;
     hm_destroy(s->map);
@@ -10,6 +10,8 @@ typedef struct {
 } set;
 
 set* set_new(void);
+/* Keys are interned into pool, which must outlive the set. */
+set* set_new_interned(intern_pool* pool);
 void set_free(set* s);
 
 bool set_add(set* s, const char* key);
@@ -5,60 +5,82 @@
 #include <string.h>
 #include <stdarg.h>
 
-#define SB_INITIAL_CAP 32
-
 static void sb_ensure_capacity(sb* s, size_t min_cap) {
     if (!s) return;
     if (s->cap >= min_cap) return;
 
-    size_t new_cap = (s->cap > 0) ? s->cap : SB_INITIAL_CAP;
+    // A zeroed sb that skipped sb_init has no buffer at all yet.
+    size_t new_cap = s->cap ? s->cap * 2 : SB_INLINE_CAP;
     while (new_cap < min_cap) {
         new_cap *= 2;
     }
 
-    char* new_buf = realloc(s->buf, new_cap * sizeof(char));
+    // The inline buffer can't be realloc'd; move out of it instead.
+    char* new_buf = s->buf == s->small ? malloc(new_cap) : realloc(s->buf, new_cap);
     if (!new_buf) {
         fprintf(stderr, "sb_ensure_capacity: out of memory\n");
         abort();
     }
+    if (s->buf == s->small) memcpy(new_buf, s->small, s->len + 1);
 
     s->buf = new_buf;
     s->cap = new_cap;
 }
 
+void sb_init(sb* s) {
+    s->buf = s->small;
+    s->len = 0;
+    s->cap = SB_INLINE_CAP;
+    s->small[0] = '\0';
+}
+
+void sb_release(sb* s) {
+    if (!s) return;
+    if (s->buf != s->small) free(s->buf);
+    sb_init(s);
+}
+
 sb* sb_new(void) {
     sb* s = malloc(sizeof(sb));
     if (!s) {
         fprintf(stderr, "sb_new: out of memory\n");
         abort();
     }
-
-    s->len = 0;
-    s->cap = 0;
-    s->buf = NULL;
-
-    sb_ensure_capacity(s, SB_INITIAL_CAP);
-    s->buf[0] = '\0';
+    sb_init(s);
     return s;
 }
 
 void sb_free(sb* s) {
     if (!s) return;
-    free(s->buf);
+    if (s->buf != s->small) free(s->buf);
     free(s);
 }
 
-void sb_append(sb* s, const char* text) {
+void sb_reserve(sb* s, size_t n) {
+    sb_ensure_capacity(s, n + 1);
+}
+
+void sb_clear(sb* s) {
+    if (!s) return;
+    s->len = 0;
+    if (s->buf) s->buf[0] = '\0';
+}
+
+void sb_append_n(sb* s, const char* text, size_t n) {
     if (!s || !text) return;
 
-    size_t add_len = strlen(text);
-    sb_ensure_capacity(s, s->len + add_len + 1);
+    sb_ensure_capacity(s, s->len + n + 1);
 
-    memcpy(s->buf + s->len, text, add_len);
-    s->len += add_len;
+    memcpy(s->buf + s->len, text, n);
+    s->len += n;
     s->buf[s->len] = '\0';
 }
 
+void sb_append(sb* s, const char* text) {
+    if (!text) return;
+    sb_append_n(s, text, strlen(text));
+}
+
 void sb_append_char(sb* s, char c) {
     if (!s) return;
 
@@ -67,22 +89,91 @@ void sb_append_char(sb* s, char c) {
     s->buf[s->len] = '\0';
 }
 
+static const char DIGIT_PAIRS[201] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+/* Digits written backwards from the end of tmp, two per division. */
 void sb_append_int(sb* s, long value) {
     if (!s) return;
 
-    char tmp[32];
-    int n = snprintf(tmp, sizeof(tmp), "%ld", value);
+    char tmp[24];
+    char* end = tmp + sizeof(tmp);
+    char* p = end;
+    // Negate in unsigned so LONG_MIN works.
+    unsigned long v = value < 0 ? 0ul - (unsigned long)value : (unsigned long)value;
+    while (v >= 100) {
+        const unsigned long pair = (v % 100) * 2;
+        v /= 100;
+        p -= 2;
+        memcpy(p, DIGIT_PAIRS + pair, 2);
+    }
+    if (v >= 10) {
+        p -= 2;
+        memcpy(p, DIGIT_PAIRS + v * 2, 2);
+    } else {
+        *--p = (char)('0' + v);
+    }
+    if (value < 0) *--p = '-';
+    sb_append_n(s, p, (size_t)(end - p));
+}
+
+void sb_vappendf(sb* s, const char* fmt, va_list args) {
+    if (!s || !fmt) return;
+
+    // Format into the space already there; only a too-long result needs
+    // a second pass, after growing to the exact size.
+    va_list retry;
+    va_copy(retry, args);
+    const size_t room = s->cap - s->len;
+    const int n = vsnprintf(s->buf + s->len, room, fmt, args);
     if (n < 0) {
+        s->buf[s->len] = '\0';
+        va_end(retry);
         return;
     }
-    if ((size_t)n >= sizeof(tmp)) {
-        n = (int)(sizeof(tmp) - 1);
-        tmp[n] = '\0';
+    if ((size_t)n >= room) {
+        sb_ensure_capacity(s, s->len + (size_t)n + 1);
+        vsnprintf(s->buf + s->len, (size_t)n + 1, fmt, retry);
     }
-    sb_append(s, tmp);
+    va_end(retry);
+    s->len += (size_t)n;
+}
+
+void sb_appendf(sb* s, const char* fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    sb_vappendf(s, fmt, args);
+    va_end(args);
 }
 
 const char* sb_str(sb* s) {
     if (!s) return NULL;
     return s->buf;
 }
+
+char* sb_detach(sb* s) {
+    if (!s) return NULL;
+
+    char* out;
+    if (s->buf == s->small) {
+        out = malloc(s->len + 1);
+        if (!out) {
+            fprintf(stderr, "sb_detach: out of memory\n");
+            abort();
+        }
+        memcpy(out, s->small, s->len + 1);
+    } else {
+        out = s->buf;
+    }
+    sb_init(s);
+    return out;
+}
@@ -2,21 +2,57 @@
 #ifndef STRINGBUILDER_H
 #define STRINGBUILDER_H
 
+/**
+ * Growable NUL-terminated string.
+ *
+ * The first SB_INLINE_CAP bytes live inside the struct, so short strings
+ * never touch the heap. An sb can be heap-allocated (sb_new/sb_free) or
+ * live on the stack (sb_init/sb_release); either way buf may point into
+ * the struct itself, so don't copy an sb by value. A stack sb must go
+ * through sb_init before use: a zeroed one still appends, but on the heap
+ * and with sb_str NULL until then.
+ *
+ * sb_clear empties the string but keeps whatever buffer it has, for
+ * building many strings in a loop without reallocating.
+ */
+
+#include <stdarg.h>
 #include <stddef.h>
 
+#define SB_INLINE_CAP 64
+
 typedef struct {
     char* buf;
     size_t len;
-    size_t cap;
+    size_t cap;                 // bytes at buf, including room for the NUL
+    char small[SB_INLINE_CAP];
 } sb;
 
 sb* sb_new(void);
 void sb_free(sb* s);
 
+/* For an sb the caller owns: init before use, release after. */
+void sb_init(sb* s);
+void sb_release(sb* s);
+
+/* Make room for n characters in total without further growth. */
+void sb_reserve(sb* s, size_t n);
+
+/* Empty the string, keeping the buffer. */
+void sb_clear(sb* s);
+
 void sb_append(sb* s, const char* text);
+void sb_append_n(sb* s, const char* text, size_t n);
 void sb_append_char(sb* s, char c);
 void sb_append_int(sb* s, long value);
 
+/* printf-style append, formatted straight into the buffer. */
+void sb_appendf(sb* s, const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+void sb_vappendf(sb* s, const char* fmt, va_list args);
+
 const char* sb_str(sb* s);
 
+/* Hand over the string as a malloc'd copy the caller frees, and clear s. */
+char* sb_detach(sb* s);
+
 #endif
@@ -0,0 +1,143 @@
+// swiss.h
+#ifndef SWISS_H
+#define SWISS_H
+
+/**
+ * Control-byte helpers shared by the SwissTable-style containers (hm,
+ * numset). Not a container itself.
+ *
+ * Each slot has a one-byte control tag: EMPTY, DELETED, or the low seven
+ * bits of the key's hash (H2) when full. Slots come in groups of 16 and a
+ * probe compares a whole group's tags against H2 at once, so the key
+ * itself is only looked at for slots whose fingerprint already matches.
+ *
+ * The match functions return a bitmask with one set bit per matching slot;
+ * walk it with swiss_first()/swiss_next().
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define SWISS_SSE2 1
+#elif defined(__ARM_NEON) || defined(__aarch64__)
+#include <arm_neon.h>
+#define SWISS_NEON 1
+#endif
+
+#define SWISS_GROUP_WIDTH 16
+
+#define SWISS_EMPTY   ((int8_t)-128) // 0b10000000
+#define SWISS_DELETED ((int8_t)-2)   // 0b11111110
+
+#if defined(SWISS_NEON)
+typedef uint64_t swiss_mask; // one nibble per slot, only its top bit kept
+#define SWISS_MASK_SHIFT 2
+#else
+typedef uint32_t swiss_mask; // one bit per slot
+#define SWISS_MASK_SHIFT 0
+#endif
+
+static inline size_t swiss_h1(uint64_t hash) {
+    return (size_t)(hash >> 7);
+}
+
+static inline int8_t swiss_h2(uint64_t hash) {
+    return (int8_t)(hash & 0x7f);
+}
+
+#if defined(SWISS_SSE2)
+
+static inline swiss_mask swiss_match(const int8_t* group, int8_t h2) {
+    const __m128i ctrl = _mm_loadu_si128((const __m128i*)group);
+    return (swiss_mask)_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(h2)));
+}
+
+static inline swiss_mask swiss_match_empty(const int8_t* group) {
+    return swiss_match(group, SWISS_EMPTY);
+}
+
+/* EMPTY or DELETED: both have the sign bit set, full slots don't. */
+static inline swiss_mask swiss_match_free(const int8_t* group) {
+    return (swiss_mask)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)group));
+}
+
+#elif defined(SWISS_NEON)
+
+static inline swiss_mask swiss_neon_mask(uint8x16_t eq) {
+    const uint8x8_t nibbles = vshrn_n_u16(vreinterpretq_u16_u8(eq), 4);
+    return vget_lane_u64(vreinterpret_u64_u8(nibbles), 0) & 0x8888888888888888ULL;
+}
+
+static inline swiss_mask swiss_match(const int8_t* group, int8_t h2) {
+    return swiss_neon_mask(vceqq_s8(vld1q_s8(group), vdupq_n_s8(h2)));
+}
+
+static inline swiss_mask swiss_match_empty(const int8_t* group) {
+    return swiss_match(group, SWISS_EMPTY);
+}
+
+static inline swiss_mask swiss_match_free(const int8_t* group) {
+    return swiss_neon_mask(vcltq_s8(vld1q_s8(group), vdupq_n_s8(0)));
+}
+
+#else
+
+static inline swiss_mask swiss_match(const int8_t* group, int8_t h2) {
+    swiss_mask m = 0;
+    for (int i = 0; i < SWISS_GROUP_WIDTH; i++) {
+        m |= (swiss_mask)(group[i] == h2) << i;
+    }
+    return m;
+}
+
+static inline swiss_mask swiss_match_empty(const int8_t* group) {
+    return swiss_match(group, SWISS_EMPTY);
+}
+
+static inline swiss_mask swiss_match_free(const int8_t* group) {
+    swiss_mask m = 0;
+    for (int i = 0; i < SWISS_GROUP_WIDTH; i++) {
+        m |= (swiss_mask)(group[i] < 0) << i;
+    }
+    return m;
+}
+
+#endif
+
+/* Slot offset (0..15) of the lowest match; mask must be non-zero. */
+static inline size_t swiss_first(swiss_mask mask) {
+#if defined(SWISS_NEON)
+    return (size_t)__builtin_ctzll(mask) >> SWISS_MASK_SHIFT;
+#else
+    return (size_t)__builtin_ctz(mask);
+#endif
+}
+
+static inline swiss_mask swiss_next(swiss_mask mask) {
+    return mask & (mask - 1);
+}
+
+/* Control array for n_groups groups, all EMPTY. */
+static inline void swiss_ctrl_reset(int8_t* ctrl, size_t n_groups) {
+    memset(ctrl, (unsigned char)SWISS_EMPTY, n_groups * SWISS_GROUP_WIDTH);
+}
+
+/**
+ * Triangular probing over whole groups: visits every group exactly once
+ * when the group count is a power of two.
+ *
+ *   size_t g = swiss_probe_start(hash, group_mask);
+ *   for (size_t step = 0; ; g = swiss_probe_next(g, ++step, group_mask)) ...
+ */
+static inline size_t swiss_probe_start(uint64_t hash, size_t group_mask) {
+    return swiss_h1(hash) & group_mask;
+}
+
+static inline size_t swiss_probe_next(size_t group, size_t step, size_t group_mask) {
+    return (group + step) & group_mask;
+}
+
+#endif
@@ -0,0 +1,217 @@
+// typed_vec.h
+#ifndef TYPED_VEC_H
+#define TYPED_VEC_H
+
+/**
+ * Type-specialised growable arrays, generated by macro.
+ *
+ *   VEC_DEFINE(point, Point)
+ *
+ * defines `vec_point { size_t len; size_t cap; Point* data; }` and inline
+ * functions vec_point_init/free/reserve/resize/clear/push/pop/back/get/
+ * at/set/empty. Elements are stored by value in one contiguous block, so
+ * no per-element malloc and no intptr_t casts. The struct lives wherever
+ * the caller puts it (stack, another struct); init before use, free after.
+ *
+ * vec_X doubles as a stack (push/pop/back). STACK_DEFINE gives the same
+ * storage stack-flavoured names.
+ *
+ *   VEC_DEFINE_SORT(point, Point, LESS)
+ *
+ * adds vec_point_sort, vec_point_lower_bound and vec_point_bsearch, with
+ * LESS(a, b) expanded inline instead of called through a comparator.
+ * Ready-made: vec_int32, vec_int64, vec_uint32, vec_uint64, all sortable.
+ *
+ * get/at/set/pop/back don't check bounds beyond an assert.
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define VEC_INITIAL_CAP_TYPED 16
+
+#define VEC_DEFINE(name, T)                                                        \
+    typedef struct {                                                               \
+        size_t len;                                                                \
+        size_t cap;                                                                \
+        T* data;                                                                   \
+    } vec_##name;                                                                  \
+                                                                                   \
+    static inline void vec_##name##_init(vec_##name* v) {                          \
+        v->len = 0;                                                                \
+        v->cap = 0;                                                                \
+        v->data = NULL;                                                            \
+    }                                                                              \
+                                                                                   \
+    static inline void vec_##name##_free(vec_##name* v) {                          \
+        if (!v) return;                                                            \
+        free(v->data);                                                             \
+        vec_##name##_init(v);                                                      \
+    }                                                                              \
+                                                                                   \
+    static inline void vec_##name##_reserve(vec_##name* v, size_t min_cap) {       \
+        if (v->cap >= min_cap) return;                                             \
+        size_t new_cap = v->cap ? v->cap : VEC_INITIAL_CAP_TYPED;                  \
+        while (new_cap < min_cap) new_cap *= 2;                                    \
+        T* data = (T*)realloc(v->data, new_cap * sizeof(T));                       \
+        if (!data) {                                                               \
+            fprintf(stderr, "vec_" #name "_reserve: out of memory\n");             \
+            abort();                                                               \
+        }                                                                          \
+        v->data = data;                                                            \
+        v->cap = new_cap;                                                          \
+    }                                                                              \
+                                                                                   \
+    /* Grow (zero-filling) or shrink to n elements. */                             \
+    static inline void vec_##name##_resize(vec_##name* v, size_t n) {             \
+        vec_##name##_reserve(v, n);                                                \
+        if (n > v->len) memset(v->data + v->len, 0, (n - v->len) * sizeof(T));     \
+        v->len = n;                                                                \
+    }                                                                              \
+                                                                                   \
+    static inline void vec_##name##_clear(vec_##name* v) {                         \
+        v->len = 0;                                                                \
+    }                                                                              \
+                                                                                   \
+    static inline bool vec_##name##_empty(const vec_##name* v) {                   \
+        return v->len == 0;                                                        \
+    }                                                                              \
+                                                                                   \
+    static inline void vec_##name##_push(vec_##name* v, T item) {                  \
+        if (v->len == v->cap) vec_##name##_reserve(v, v->len + 1);                 \
+        v->data[v->len++] = item;                                                  \
+    }                                                                              \
+                                                                                   \
+    static inline T vec_##name##_pop(vec_##name* v) {                              \
+        assert(v->len > 0);                                                        \
+        return v->data[--v->len];                                                  \
+    }                                                                              \
+                                                                                   \
+    static inline T* vec_##name##_back(vec_##name* v) {                            \
+        assert(v->len > 0);                                                        \
+        return &v->data[v->len - 1];                                               \
+    }                                                                              \
+                                                                                   \
+    static inline T vec_##name##_get(const vec_##name* v, size_t i) {              \
+        assert(i < v->len);                                                        \
+        return v->data[i];                                                         \
+    }                                                                              \
+                                                                                   \
+    static inline T* vec_##name##_at(vec_##name* v, size_t i) {                    \
+        assert(i < v->len);                                                        \
+        return &v->data[i];                                                        \
+    }                                                                              \
+                                                                                   \
+    static inline void vec_##name##_set(vec_##name* v, size_t i, T item) {         \
+        assert(i < v->len);                                                        \
+        v->data[i] = item;                                                         \
+    }
+
+/* Below this many elements, sort partitions by insertion. */
+#define VEC_SORT_CUTOFF 16
+
+#define VEC_DEFINE_SORT(name, T, LESS)                                             \
+    static inline void vec_##name##_sort_range(T* a, size_t n) {                   \
+        while (n > VEC_SORT_CUTOFF) {                                              \
+            /* Median of three to the front, then Hoare partition. */              \
+            const size_t mid = n / 2;                                              \
+            T tmp;                                                                 \
+            if (LESS(a[mid], a[0])) { tmp = a[mid]; a[mid] = a[0]; a[0] = tmp; }   \
+            if (LESS(a[n - 1], a[0])) { tmp = a[n-1]; a[n-1] = a[0]; a[0] = tmp; } \
+            if (LESS(a[n - 1], a[mid])) { tmp = a[n-1]; a[n-1] = a[mid]; a[mid] = tmp; } \
+            const T pivot = a[mid];                                                \
+            size_t i = 0, j = n - 1;                                               \
+            for (;;) {                                                             \
+                while (LESS(a[i], pivot)) i++;                                     \
+                while (LESS(pivot, a[j])) j--;                                     \
+                if (i >= j) break;                                                 \
+                tmp = a[i]; a[i] = a[j]; a[j] = tmp;                               \
+                i++;                                                               \
+                j--;                                                               \
+            }                                                                      \
+            /* Recurse into the smaller half, loop on the larger. */               \
+            const size_t left = j + 1;                                             \
+            if (left < n - left) {                                                 \
+                vec_##name##_sort_range(a, left);                                  \
+                a += left;                                                         \
+                n -= left;                                                         \
+            } else {                                                               \
+                vec_##name##_sort_range(a + left, n - left);                       \
+                n = left;                                                          \
+            }                                                                      \
+        }                                                                          \
+        for (size_t i = 1; i < n; i++) {                                           \
+            const T x = a[i];                                                      \
+            size_t j = i;                                                          \
+            while (j > 0 && LESS(x, a[j - 1])) {                                   \
+                a[j] = a[j - 1];                                                   \
+                j--;                                                               \
+            }                                                                      \
+            a[j] = x;                                                              \
+        }                                                                          \
+    }                                                                              \
+                                                                                   \
+    static inline void vec_##name##_sort(vec_##name* v) {                          \
+        vec_##name##_sort_range(v->data, v->len);                                  \
+    }                                                                              \
+                                                                                   \
+    /* First index whose element is not LESS than key (v sorted). */               \
+    static inline size_t vec_##name##_lower_bound(const vec_##name* v, T key) {    \
+        size_t lo = 0, hi = v->len;                                                \
+        while (lo < hi) {                                                          \
+            const size_t mid = lo + (hi - lo) / 2;                                 \
+            if (LESS(v->data[mid], key)) lo = mid + 1;                             \
+            else hi = mid;                                                         \
+        }                                                                          \
+        return lo;                                                                 \
+    }                                                                              \
+                                                                                   \
+    /* Index of an element equal to key, or SIZE_MAX (v sorted). */               \
+    static inline size_t vec_##name##_bsearch(const vec_##name* v, T key) {        \
+        const size_t i = vec_##name##_lower_bound(v, key);                         \
+        return (i < v->len && !LESS(key, v->data[i])) ? i : SIZE_MAX;              \
+    }
+
+#define STACK_DEFINE(name, T)                                                      \
+    VEC_DEFINE(name##_stackvec, T)                                                 \
+    typedef vec_##name##_stackvec stack_##name;                                    \
+                                                                                   \
+    static inline void stack_##name##_init(stack_##name* s) {                      \
+        vec_##name##_stackvec_init(s);                                             \
+    }                                                                              \
+    static inline void stack_##name##_free(stack_##name* s) {                      \
+        vec_##name##_stackvec_free(s);                                             \
+    }                                                                              \
+    static inline void stack_##name##_push(stack_##name* s, T item) {              \
+        vec_##name##_stackvec_push(s, item);                                       \
+    }                                                                              \
+    static inline T stack_##name##_pop(stack_##name* s) {                          \
+        return vec_##name##_stackvec_pop(s);                                       \
+    }                                                                              \
+    static inline T* stack_##name##_top(stack_##name* s) {                         \
+        return vec_##name##_stackvec_back(s);                                      \
+    }                                                                              \
+    static inline bool stack_##name##_empty(const stack_##name* s) {               \
+        return s->len == 0;                                                        \
+    }                                                                              \
+    static inline size_t stack_##name##_size(const stack_##name* s) {              \
+        return s->len;                                                             \
+    }
+
+#define VEC_LESS_SCALAR(a, b) ((a) < (b))
+
+VEC_DEFINE(int32, int32_t)
+VEC_DEFINE_SORT(int32, int32_t, VEC_LESS_SCALAR)
+VEC_DEFINE(int64, int64_t)
+VEC_DEFINE_SORT(int64, int64_t, VEC_LESS_SCALAR)
+VEC_DEFINE(uint32, uint32_t)
+VEC_DEFINE_SORT(uint32, uint32_t, VEC_LESS_SCALAR)
+VEC_DEFINE(uint64, uint64_t)
+VEC_DEFINE_SORT(uint64, uint64_t, VEC_LESS_SCALAR)
+
+#endif
@@ -0,0 +1,76 @@
+#include "aoc_client.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define AOC_MAX_DAYS 25
+
+static void print_usage(const char *prog) {
+    fprintf(stderr,
+            "Usage: %s YEAR [DAY...] [--force]\n"
+            "\n"
+            "Downloads the inputs for the given days into the cache.\n"
+            "Without DAY arguments all days of YEAR are fetched.\n",
+            prog);
+}
+
+/* AoC ran 25 days per year until 2024 and 12 days from 2025 on. */
+static int days_in_year(int year) {
+    return year >= 2025 ? 12 : 25;
+}
+
+int main(int argc, char **argv) {
+    int year = 0;
+    int force = 0;
+    int days[AOC_MAX_DAYS];
+    size_t n_days = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--force") == 0) {
+            force = 1;
+        } else if (strcmp(argv[i], "--help") == 0 || strcmp(argv[i], "-h") == 0) {
+            print_usage(argv[0]);
+            return 0;
+        } else if (year == 0) {
+            year = atoi(argv[i]);
+        } else {
+            const int day = atoi(argv[i]);
+            if (day < 1 || day > AOC_MAX_DAYS) {
+                fprintf(stderr, "Invalid day: %s\n", argv[i]);
+                return 1;
+            }
+            if (n_days < AOC_MAX_DAYS) {
+                days[n_days++] = day;
+            }
+        }
+    }
+
+    if (year < 2015) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    if (n_days == 0) {
+        const int last = days_in_year(year);
+        for (int d = 1; d <= last; d++) {
+            days[n_days++] = d;
+        }
+    }
+
+    AocClient client;
+    if (aoc_client_init(&client) != 0) {
+        fprintf(stderr, "Failed to initialize AoC client.\n");
+        return 1;
+    }
+
+    const int failures = aoc_prefetch_inputs(&client, year, days, n_days, force);
+    aoc_client_free(&client);
+
+    if (failures != 0) {
+        fprintf(stderr, "Prefetch for %d finished with %d failure(s).\n", year, failures < 0 ? 1 : failures);
+        return 1;
+    }
+    printf("Inputs for %d cached.\n", year);
+    return 0;
+}
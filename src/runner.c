@@ -1,16 +1,56 @@
-#include "aoc_client.h"
+#include "aoc_cache.h"
+#include "aoc_net.h"
 #include "solver.h"
+#include "thread_pool.h"
 #include "util.h"
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+static int submission_exit_code(AocSubmissionStatus status) {
+    switch (status) {
+        case AOC_SUBMISSION_CORRECT:         return 0;
+        case AOC_SUBMISSION_INCORRECT:       return 2;
+        case AOC_SUBMISSION_TOO_RECENT:      return 3;
+        case AOC_SUBMISSION_ALREADY_COMPLETED: return 4;
+        default:                             return 1;
+    }
+}
+
+typedef struct {
+    AocNet net;
+    AocClient client;
+    int ready;
+} Network;
+
+static int network_open(Network *n) {
+    if (n->ready) return 0;
+    if (aoc_net_load(&n->net) != 0) return -1;
+    if (n->net.client_init(&n->client) != 0) {
+        fprintf(stderr, "Failed to initialize AoC client.\n");
+        n->net.client_free(&n->client);
+        aoc_net_unload(&n->net);
+        return -1;
+    }
+    n->ready = 1;
+    return 0;
+}
+
+static void network_close(Network *n) {
+    if (!n->ready) return;
+    n->net.client_free(&n->client);
+    aoc_net_unload(&n->net);
+    n->ready = 0;
+}
+
 static void print_usage(const char *prog) {
     fprintf(stderr,
-            "Usage: %s [--part 1|2] [--submit] [--force]\n"
+            "Usage: %s [--part 1|2] [--submit [--wait]] [--force] [--threads N]\n"
             "\n"
             "Defaults: --part 1, no --submit, no --force\n"
+            "--wait resubmits after the server's cooldown instead of exiting with code 3.\n"
+            "--threads caps the worker pool for parallel solvers (default: one per CPU).\n"
             "Uses AOC_YEAR=%d, AOC_DAY=%d from the linked day module.\n",
             prog, AOC_YEAR, AOC_DAY);
 }
@@ -18,6 +58,7 @@ static void print_usage(const char *prog) {
 int main(int argc, char **argv) {
     int part = 1;
     int do_submit = 0;
+    int wait_cooldown = 0;
     int force = 0;
     int bench_runs = 0;
 
@@ -34,6 +75,8 @@ int main(int argc, char **argv) {
             }
         } else if (strcmp(argv[i], "--submit") == 0 || strcmp(argv[i], "-s") == 0) {
             do_submit = 1;
+        } else if (strcmp(argv[i], "--wait") == 0) {
+            wait_cooldown = 1;
         } else if (strcmp(argv[i], "--force") == 0) {
             force = 1;
         } else if (strcmp(argv[i], "--help") == 0 || strcmp(argv[i], "-h") == 0) {
@@ -41,6 +84,8 @@ int main(int argc, char **argv) {
             return 0;
         } else if (strcmp(argv[i], "--bench") == 0 && i+1 < argc) {
             bench_runs = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--threads") == 0 && i+1 < argc) {
+            thread_pool_set_threads(atoi(argv[++i]));
         } else {
             fprintf(stderr, "Unknown argument: %s\n", argv[i]);
             print_usage(argv[0]);
@@ -48,30 +93,43 @@ int main(int argc, char **argv) {
         }
     }
 
-    AocClient client;
-    if (aoc_client_init(&client) != 0) {
-        fprintf(stderr, "Failed to initialize AoC client.\n");
-        return 1;
+    // Cached input is read directly; the network library is only loaded
+    // when we have to download or submit.
+    Network network = {0};
+    file_view input;
+    if (force || aoc_cache_read_input(AOC_DEFAULT_CACHE_DIR, AOC_YEAR, AOC_DAY, &input) != 0) {
+        if (network_open(&network) != 0) {
+            return 1;
+        }
+        if (network.net.get_input(&network.client, AOC_YEAR, AOC_DAY, force, &input) != 0) {
+            fprintf(stderr, "Error: could not get input for %d day %d.\n", AOC_YEAR, AOC_DAY);
+            network_close(&network);
+            return 1;
+        }
     }
 
-    char *input = NULL;
-    if (aoc_get_input(&client, AOC_YEAR, AOC_DAY, force, &input) != 0) {
-        fprintf(stderr, "Error: could not get input for %d day %d.\n", AOC_YEAR, AOC_DAY);
-        aoc_client_free(&client);
-        return 1;
+    if (do_submit) {
+        if (network_open(&network) != 0) {
+            file_view_close(&input);
+            return 1;
+        }
+        if (bench_runs == 0) {
+            // Connect while the solver runs so the POST can go out immediately.
+            network.net.submit_prewarm(&network.client, AOC_YEAR, AOC_DAY);
+        }
     }
 
     char *answer = NULL;
     if (part == 1) {
-        answer = solve_part1(input);
+        answer = solve_part1(input.data);
     } else {
-        answer = solve_part2(input);
+        answer = solve_part2(input.data);
     }
 
     if (!answer) {
         fprintf(stderr, "Solver returned NULL (part %d).\n", part);
-        free(input);
-        aoc_client_free(&client);
+        file_view_close(&input);
+        network_close(&network);
         return 1;
     }
     if (bench_runs == 0) {
@@ -82,30 +140,29 @@ int main(int argc, char **argv) {
 
     if (do_submit) {
         AocSubmissionResult res;
-        if (aoc_submit_answer(&client, AOC_YEAR, AOC_DAY, part, answer, &res) != 0) {
+        const int rc = wait_cooldown
+            ? network.net.submit_answer_when_allowed(&network.client, AOC_YEAR, AOC_DAY, part, answer, &res)
+            : network.net.submit_answer(&network.client, AOC_YEAR, AOC_DAY, part, answer, &res);
+        if (rc != 0) {
             fprintf(stderr, "Error: failed to submit answer.\n");
             exit_code = 1;
         } else {
             printf("\n--- Submission result ---\n%s\n", res.message ? res.message : "(no message)");
-            switch (res.status) {
-                case AOC_SUBMISSION_CORRECT:         exit_code = 0; break;
-                case AOC_SUBMISSION_INCORRECT:       exit_code = 2; break;
-                case AOC_SUBMISSION_TOO_RECENT:      exit_code = 3; break;
-                case AOC_SUBMISSION_ALREADY_COMPLETED: exit_code = 4; break;
-                default:                             exit_code = 1; break;
-            }
-            aoc_submission_result_free(&res);
+            exit_code = submission_exit_code(res.status);
         }
+        network.net.submission_result_free(&res);
     }
 
     if (bench_runs > 0) {
-        benchmark_solver("part1", solve_part1, input, bench_runs);
-        benchmark_solver("part2", solve_part2, input, bench_runs);
+        benchmark_solver("part1", solve_part1, input.data, bench_runs);
+        benchmark_solver("part2", solve_part2, input.data, bench_runs);
+        thread_pool_shutdown();
         return 0;
     }
 
     free(answer);
-    free(input);
-    aoc_client_free(&client);
+    file_view_close(&input);
+    network_close(&network);
+    thread_pool_shutdown();
     return exit_code;
 }
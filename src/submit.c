@@ -0,0 +1,68 @@
+#include "aoc_client.h"
+#include "aoc_submit_queue.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static void print_usage(const char *prog) {
+    fprintf(stderr,
+            "Usage: %s YEAR DAY PART ANSWER [YEAR DAY PART ANSWER ...]\n"
+            "\n"
+            "Submits all answers, each at the earliest moment the server's\n"
+            "rate limit allows. Exits non-zero unless every answer is correct\n"
+            "or the level was already completed.\n",
+            prog);
+}
+
+static void print_result(const AocPendingSubmission *sub, void *ctx) {
+    int *all_ok = ctx;
+    const AocSubmissionResult *res = &sub->result;
+    printf("%d day %d part %d (%s): %s\n",
+           sub->year, sub->day, sub->level, sub->answer,
+           res->message ? res->message : "(no message)");
+    fflush(stdout);
+    if (res->status != AOC_SUBMISSION_CORRECT && res->status != AOC_SUBMISSION_ALREADY_COMPLETED) {
+        *all_ok = 0;
+    }
+}
+
+int main(int argc, char **argv) {
+    if (argc < 5 || (argc - 1) % 4 != 0) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    AocSubmitQueue q;
+    aoc_submit_queue_init(&q);
+    for (int i = 1; i + 3 < argc; i += 4) {
+        const int year = atoi(argv[i]);
+        const int day = atoi(argv[i + 1]);
+        const int part = atoi(argv[i + 2]);
+        if (year < 2015 || day < 1 || day > 25 || (part != 1 && part != 2)) {
+            fprintf(stderr, "Invalid submission: %s %s %s %s\n",
+                    argv[i], argv[i + 1], argv[i + 2], argv[i + 3]);
+            aoc_submit_queue_free(&q);
+            return 1;
+        }
+        if (aoc_submit_queue_add(&q, year, day, part, argv[i + 3]) != 0) {
+            fprintf(stderr, "Out of memory.\n");
+            aoc_submit_queue_free(&q);
+            return 1;
+        }
+    }
+
+    AocClient client;
+    if (aoc_client_init(&client) != 0) {
+        fprintf(stderr, "Failed to initialize AoC client.\n");
+        aoc_submit_queue_free(&q);
+        return 1;
+    }
+
+    int all_ok = 1;
+    const int failures = aoc_submit_queue_run(&client, &q, print_result, &all_ok);
+
+    aoc_submit_queue_free(&q);
+    aoc_client_free(&client);
+    return (failures == 0 && all_ok) ? 0 : 1;
+}
@@ -0,0 +1,337 @@
+#define _GNU_SOURCE // nftw, mkdtemp, setenv, RTLD_NEXT
+
+#include <assert.h>
+#include <curl/curl.h>
+#include <dlfcn.h>
+#include <dirent.h>
+#include <ftw.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "aoc_client.h"
+#include "aoc_submit_queue.h"
+#include "util.h"
+#include "tests/mock_aoc_server.h"
+
+static MockAocServer* server;
+
+/* Set to make curl_multi_perform fail, as if libcurl ran out of memory.
+ * This definition takes precedence over libcurl's for calls made from
+ * aoc_net. */
+static int fail_multi_perform;
+
+CURLMcode curl_multi_perform(CURLM* multi, int* running) {
+    if (fail_multi_perform) return CURLM_OUT_OF_MEMORY;
+    static CURLMcode (*real)(CURLM*, int*);
+    if (!real) *(void**)&real = dlsym(RTLD_NEXT, "curl_multi_perform");
+    return real(multi, running);
+}
+
+static void init_client(AocClient* client, const char* cache_dir) {
+    setenv("AOC_SESSION", "test-session", 1);
+    setenv("AOC_BASE_URL", mock_aoc_server_url(server), 1);
+    const int rc = aoc_client_init(client);
+    assert(rc == 0);
+    (void)rc;
+
+    free(client->config.cache_dir);
+    client->config.cache_dir = str_dup(cache_dir);
+}
+
+static int remove_entry(const char* path, const struct stat* sb, int flag, struct FTW* ftw) {
+    (void)sb;
+    (void)flag;
+    (void)ftw;
+    return remove(path);
+}
+
+static void remove_tree(const char* path) {
+    nftw(path, remove_entry, 16, FTW_DEPTH | FTW_PHYS);
+}
+
+static void test_get_input(const char* cache_dir) {
+    AocClient client;
+    init_client(&client, cache_dir);
+
+    const size_t before = mock_aoc_server_requests(server);
+    (void)before;
+
+    file_view input;
+    int rc = aoc_get_input(&client, 2025, 1, 0, &input);
+    assert(rc == 0);
+    assert(strcmp(input.data, "2025 day 1") == 0); // trailing newline stripped
+    assert(input.len == strlen("2025 day 1"));
+    file_view_close(&input);
+    assert(mock_aoc_server_requests(server) == before + 1);
+
+    // Served from the cache now.
+    rc = aoc_get_input(&client, 2025, 1, 0, &input);
+    assert(rc == 0);
+    assert(strcmp(input.data, "2025 day 1") == 0);
+    file_view_close(&input);
+    assert(mock_aoc_server_requests(server) == before + 1);
+
+    // --force goes back to the server.
+    rc = aoc_get_input(&client, 2025, 1, 1, &input);
+    assert(rc == 0);
+    file_view_close(&input);
+    assert(mock_aoc_server_requests(server) == before + 2);
+
+    // Unknown paths are an error, not an empty input, and leave no cache
+    // or temp file behind.
+    rc = aoc_get_input(&client, 2025, 99, 0, &input);
+    assert(rc != 0);
+    (void)rc;
+    assert(input.data == NULL);
+    char* missing = format_string("%s/2025/day99.txt", cache_dir);
+    assert(access(missing, F_OK) != 0);
+    free(missing);
+    char* year_dir = format_string("%s/2025", cache_dir);
+    int entries = 0;
+    for (DIR* d = opendir(year_dir); d; ) {
+        struct dirent* e = readdir(d);
+        if (!e) {
+            closedir(d);
+            break;
+        }
+        if (e->d_name[0] != '.') entries++;
+    }
+    assert(entries == 1); // day01.txt only
+    free(year_dir);
+
+    aoc_client_free(&client);
+}
+
+static void test_prefetch(const char* cache_dir) {
+    AocClient client;
+    init_client(&client, cache_dir);
+
+    int days[12];
+    for (int i = 0; i < 12; i++) days[i] = i + 1;
+
+    const size_t conns_before = mock_aoc_server_connections(server);
+    (void)conns_before;
+    int failures = aoc_prefetch_inputs(&client, 2024, days, 12, 0);
+    assert(failures == 0);
+    // Transfers are bounded and share connections.
+    assert(mock_aoc_server_connections(server) - conns_before <= 4);
+
+    for (int d = 1; d <= 12; d++) {
+        char* path = format_string("%s/2024/day%02d.txt", cache_dir, d);
+        char* content = NULL;
+        const int rc = read_file_to_string(path, &content);
+        assert(rc == 0);
+        (void)rc;
+        char expected[32];
+        snprintf(expected, sizeof(expected), "2024 day %d", d);
+        assert(strcmp(content, expected) == 0);
+        free(content);
+        free(path);
+    }
+
+    // Everything cached: nothing to fetch.
+    const size_t requests_before = mock_aoc_server_requests(server);
+    (void)requests_before;
+    failures = aoc_prefetch_inputs(&client, 2024, days, 12, 0);
+    assert(failures == 0);
+    assert(mock_aoc_server_requests(server) == requests_before);
+    (void)failures;
+
+    // curl_multi failing after the first batch is started: the jobs still
+    // in flight and the ones never started all count as failures.
+    fail_multi_perform = 1;
+    failures = aoc_prefetch_inputs(&client, 2023, days, 12, 0);
+    assert(failures == 12);
+    fail_multi_perform = 0;
+    char* year_dir = format_string("%s/2023", cache_dir);
+    DIR* dir = opendir(year_dir);
+    if (dir) {
+        const struct dirent* entry;
+        while ((entry = readdir(dir)) != NULL) {
+            assert(strncmp(entry->d_name, "day", 3) != 0);
+        }
+        closedir(dir);
+    }
+    free(year_dir);
+
+    aoc_client_free(&client);
+}
+
+static void expect_submission(AocClient* client, const char* answer,
+                              AocSubmissionStatus expected, const char* needle) {
+    AocSubmissionResult res;
+    const int rc = aoc_submit_answer(client, 2025, 1, 1, answer, &res);
+    assert(rc == 0);
+    assert(res.status == expected);
+    assert(res.message != NULL);
+    assert(strstr(res.message, needle) != NULL);
+    assert(strchr(res.message, '<') == NULL); // tags stripped
+    assert(res.raw_html != NULL);
+    (void)rc;
+    (void)expected;
+    (void)needle;
+    aoc_submission_result_free(&res);
+}
+
+static void test_submit(const char* cache_dir) {
+    AocClient client;
+    init_client(&client, cache_dir);
+
+    const size_t conns_before = mock_aoc_server_connections(server);
+    (void)conns_before;
+    const int rc = aoc_submit_prewarm(&client, 2025, 1);
+    assert(rc == 0);
+    (void)rc;
+
+    expect_submission(&client, "right", AOC_SUBMISSION_CORRECT, "That's the right answer!");
+    expect_submission(&client, "wrong", AOC_SUBMISSION_INCORRECT, "too low");
+    expect_submission(&client, "wait", AOC_SUBMISSION_TOO_RECENT, "You have 4m 32s left to wait");
+    expect_submission(&client, "done", AOC_SUBMISSION_ALREADY_COMPLETED, "Did you already complete it?");
+    expect_submission(&client, "42", AOC_SUBMISSION_UNKNOWN, "Something unexpected happened.");
+
+    // Warm-up and all submissions went over one keep-alive connection.
+    assert(mock_aoc_server_connections(server) - conns_before == 1);
+
+    aoc_client_free(&client);
+}
+
+static void test_parse_wait_seconds(void) {
+    assert(aoc_parse_wait_seconds("You have 4m 32s left to wait.") == 272);
+    assert(aoc_parse_wait_seconds("You gave an answer too recently; you have to wait after submitting "
+                                  "an answer before trying again.  You have 9s left to wait. [Return]") == 9);
+    assert(aoc_parse_wait_seconds("You have 1h 2m left to wait") == 3720);
+    assert(aoc_parse_wait_seconds("Please wait one minute before trying again.") == 60);
+    assert(aoc_parse_wait_seconds("please wait 5 minutes before trying again.") == 300);
+    assert(aoc_parse_wait_seconds("That's the right answer!") == 0);
+    assert(aoc_parse_wait_seconds(NULL) == 0);
+}
+
+static void count_result(const AocPendingSubmission* sub, void* ctx) {
+    (void)sub;
+    (*(int*)ctx)++;
+}
+
+static void test_submit_queue(const char* cache_dir) {
+    AocClient client;
+    init_client(&client, cache_dir);
+    mock_aoc_server_set_cooldown(server, 1);
+
+    // A wrong answer locks the account; the next one must wait, not spam.
+    AocSubmitQueue q;
+    aoc_submit_queue_init(&q);
+    int rc = aoc_submit_queue_add(&q, 2025, 1, 1, "wrong");
+    assert(rc == 0);
+    rc = aoc_submit_queue_add(&q, 2025, 2, 1, "right");
+    assert(rc == 0);
+    rc = aoc_submit_queue_add(&q, 2025, 3, 2, "right");
+    assert(rc == 0);
+
+    size_t requests_before = mock_aoc_server_requests(server);
+    int results = 0;
+    const double start = now_sec();
+    rc = aoc_submit_queue_run(&client, &q, count_result, &results);
+    const double elapsed = now_sec() - start;
+    assert(rc == 0);
+    assert(elapsed >= 1.0);
+    (void)elapsed;
+    assert(results == 3);
+    assert(q.items[0].result.status == AOC_SUBMISSION_INCORRECT);
+    assert(q.items[1].result.status == AOC_SUBMISSION_CORRECT);
+    assert(q.items[2].result.status == AOC_SUBMISSION_CORRECT);
+    assert(mock_aoc_server_requests(server) - requests_before == 3);
+    aoc_submit_queue_free(&q);
+
+    // Locked by a submission the queue didn't see: reschedule on "too recent".
+    AocSubmissionResult res;
+    rc = aoc_submit_answer(&client, 2025, 4, 1, "wrong", &res);
+    assert(rc == 0);
+    assert(res.wait_seconds == 1);
+    aoc_submission_result_free(&res);
+
+    aoc_submit_queue_init(&q);
+    rc = aoc_submit_queue_add(&q, 2025, 4, 1, "right");
+    assert(rc == 0);
+    requests_before = mock_aoc_server_requests(server);
+    rc = aoc_submit_queue_run(&client, &q, NULL, NULL);
+    assert(rc == 0);
+    assert(q.items[0].result.status == AOC_SUBMISSION_CORRECT);
+    assert(q.items[0].attempts == 2);
+    assert(mock_aoc_server_requests(server) - requests_before == 2);
+    (void)rc;
+    (void)requests_before;
+    aoc_submit_queue_free(&q);
+
+    mock_aoc_server_set_cooldown(server, 0);
+    aoc_client_free(&client);
+}
+
+static void bench_client(const char* cache_dir) {
+    AocClient client;
+    init_client(&client, cache_dir);
+
+    const int runs = 200;
+    file_view input;
+    double start = now_sec();
+    int rc;
+    for (int i = 0; i < runs; i++) {
+        rc = aoc_get_input(&client, 2023, 1, 1, &input);
+        assert(rc == 0);
+        file_view_close(&input);
+    }
+    const double fetch_avg = (now_sec() - start) / runs;
+
+    AocSubmissionResult res;
+    start = now_sec();
+    for (int i = 0; i < runs; i++) {
+        rc = aoc_submit_answer(&client, 2023, 1, 1, "right", &res);
+        assert(rc == 0);
+        aoc_submission_result_free(&res);
+    }
+    const double submit_avg = (now_sec() - start) / runs;
+
+    const size_t big = (size_t)8 << 20;
+    mock_aoc_server_set_input_size(server, big);
+    start = now_sec();
+    rc = aoc_get_input(&client, 2023, 2, 1, &input);
+    const double big_time = now_sec() - start;
+    assert(rc == 0);
+    (void)rc;
+    assert(input.len == big - 1);
+    assert(input.data[input.len] == '\0');
+    file_view_close(&input);
+    mock_aoc_server_set_input_size(server, 0);
+
+    fprintf(stderr,
+            "[bench client] fetch avg=%.3fms  submit avg=%.3fms  8MiB input=%.1fms (%.0f MiB/s)\n",
+            fetch_avg * 1000.0, submit_avg * 1000.0, big_time * 1000.0,
+            8.0 / big_time);
+
+    aoc_client_free(&client);
+}
+
+int main(void) {
+    printf("Running AoC client tests...\n");
+
+    server = mock_aoc_server_start();
+    assert(server != NULL);
+
+    char cache_dir[] = "/tmp/aoc_client_test.XXXXXX";
+    const char* made = mkdtemp(cache_dir);
+    assert(made != NULL);
+    (void)made;
+
+    test_get_input(cache_dir);
+    test_prefetch(cache_dir);
+    test_submit(cache_dir);
+    test_parse_wait_seconds();
+    test_submit_queue(cache_dir);
+    bench_client(cache_dir);
+
+    remove_tree(cache_dir);
+    mock_aoc_server_stop(server);
+
+    printf("All AoC client tests passed.\n");
+    return 0;
+}
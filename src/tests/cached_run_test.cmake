@@ -0,0 +1,42 @@
+# Runs DAY_BIN (2025 day 1) against a pre-populated cache with the network
+# library pointed at a path that doesn't exist and no session token. An
+# explicit AOC_NET_LIBRARY is the only path the runner tries, so the cached
+# run can only succeed if it never loads aoc_net / libcurl. A --force run,
+# which has to load it, must fail for exactly that reason.
+
+file(REMOVE_RECURSE "${WORK_DIR}")
+file(MAKE_DIRECTORY "${WORK_DIR}/.aoc_cache/2025")
+file(WRITE "${WORK_DIR}/.aoc_cache/2025/day01.txt" "L68\nL30\nR48\nL5\nR60\nL55\nL1\nL99\nR14\nL82")
+
+set(ENV{AOC_NET_LIBRARY} "${WORK_DIR}/does-not-exist.so")
+unset(ENV{AOC_SESSION})
+
+execute_process(
+        COMMAND "${DAY_BIN}" --part 1
+        WORKING_DIRECTORY "${WORK_DIR}"
+        RESULT_VARIABLE result
+        OUTPUT_VARIABLE output
+        ERROR_VARIABLE errors
+)
+
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "cached run failed (${result}):\n${output}${errors}")
+endif()
+if(NOT output MATCHES "Answer for 2025 day 1 part 1: 3")
+    message(FATAL_ERROR "unexpected output:\n${output}${errors}")
+endif()
+
+execute_process(
+        COMMAND "${DAY_BIN}" --part 1 --force
+        WORKING_DIRECTORY "${WORK_DIR}"
+        RESULT_VARIABLE result
+        OUTPUT_VARIABLE output
+        ERROR_VARIABLE errors
+)
+
+if(result EQUAL 0)
+    message(FATAL_ERROR "--force run loaded a network library from elsewhere:\n${output}${errors}")
+endif()
+if(NOT errors MATCHES "cannot load network library")
+    message(FATAL_ERROR "--force run failed for another reason (${result}):\n${output}${errors}")
+endif()
@@ -1,16 +1,34 @@
 #include <assert.h>
+#include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdint.h>
+#include <pthread.h>
 
 #include "containers/vector.h"
+#include "containers/typed_vec.h"
 #include "containers/queue.h"
+#include "containers/ring.h"
+#include "containers/pq.h"
+#include "containers/lockfree_queue.h"
 #include "containers/stack.h"
 #include "containers/set.h"
+#include "containers/hashmap.h"
+#include "containers/numset.h"
+#include "containers/intern.h"
+#include "containers/intervalset.h"
+#include "containers/roaring.h"
 #include "containers/stringbuilder.h"
 #include "containers/grid.h"
+#include "containers/bitgrid.h"
+#include "containers/bitset.h"
+#include "containers/padgrid.h"
+#include "containers/dsu.h"
+#include "containers/grid_bfs.h"
 #include "containers/point.h"
+#include "containers/podmap.h"
+#include "containers/pointset.h"
 
 static void test_vector(void) {
     vec* v = vec_new();
@@ -34,6 +52,71 @@ static void test_vector(void) {
     vec_free(v);
 }
 
+typedef struct {
+    int key;
+    int order;
+} keyed;
+
+#define KEYED_LESS(a, b) ((a).key < (b).key)
+
+VEC_DEFINE(keyed, keyed)
+VEC_DEFINE_SORT(keyed, keyed, KEYED_LESS)
+STACK_DEFINE(point, Point)
+
+static void test_typed_vec(void) {
+    vec_int32 v;
+    vec_int32_init(&v);
+    assert(vec_int32_empty(&v));
+    for (int32_t i = 0; i < 1000; i++) {
+        vec_int32_push(&v, (i * 7919) % 1000 - 500);
+    }
+    assert(v.len == 1000);
+    assert(vec_int32_get(&v, 1) == 7919 % 1000 - 500);
+    *vec_int32_at(&v, 0) = 12345;
+    assert(v.data[0] == 12345);
+    assert(vec_int32_pop(&v) == (999 * 7919) % 1000 - 500);
+
+    vec_int32_sort(&v);
+    for (size_t i = 1; i < v.len; i++) {
+        assert(v.data[i - 1] <= v.data[i]);
+    }
+    assert(vec_int32_bsearch(&v, 12345) == v.len - 1);
+    assert(vec_int32_bsearch(&v, 100000) == SIZE_MAX);
+    assert(v.data[vec_int32_lower_bound(&v, 0)] == 0);
+
+    vec_int32_resize(&v, 2000);
+    assert(v.len == 2000 && v.data[1999] == 0);
+    vec_int32_clear(&v);
+    assert(vec_int32_empty(&v));
+    vec_int32_free(&v);
+
+    // Structs by value; many duplicates and already-sorted input.
+    vec_keyed k;
+    vec_keyed_init(&k);
+    for (int i = 0; i < 5000; i++) {
+        vec_keyed_push(&k, (keyed){ i % 37, i });
+    }
+    vec_keyed_sort(&k);
+    for (size_t i = 1; i < k.len; i++) {
+        assert(k.data[i - 1].key <= k.data[i].key);
+    }
+    vec_keyed_sort(&k);
+    assert(k.data[0].key == 0 && k.data[k.len - 1].key == 36);
+    assert(k.data[vec_keyed_bsearch(&k, (keyed){ 20, 0 })].key == 20);
+    vec_keyed_free(&k);
+
+    stack_point s;
+    stack_point_init(&s);
+    stack_point_push(&s, (Point){ 1, 2 });
+    stack_point_push(&s, (Point){ 3, 4 });
+    assert(stack_point_size(&s) == 2);
+    assert(stack_point_top(&s)->x == 3);
+    assert(stack_point_pop(&s).y == 4);
+    assert(stack_point_pop(&s).x == 1);
+    assert(stack_point_empty(&s));
+    stack_point_free(&s);
+}
+
 static void test_queue(void) {
     queue* q = queue_new();
     assert(q != NULL);
@@ -51,9 +134,157 @@ static void test_queue(void) {
     assert(queue_pop(q) == NULL);
     assert(queue_empty(q));
 
+    // Grow while wrapped around.
+    for (intptr_t i = 0; i < 10; i++) queue_push(q, (void*)i);
+    for (intptr_t i = 0; i < 10; i++) assert((intptr_t)queue_pop(q) == i);
+    for (intptr_t i = 0; i < 100; i++) queue_push(q, (void*)i);
+    for (intptr_t i = 0; i < 100; i++) assert((intptr_t)queue_pop(q) == i);
+    assert(queue_empty(q));
+
     queue_free(q);
 }
 
+static void test_ring(void) {
+    ring_int32 r;
+    ring_int32_init(&r);
+    assert(ring_int32_empty(&r));
+
+    // Interleave so head wraps before every growth.
+    int32_t next_in = 0, next_out = 0;
+    for (int round = 0; round < 200; round++) {
+        for (int i = 0; i < round % 7 + 3; i++) ring_int32_push(&r, next_in++);
+        for (int i = 0; i < 2; i++) {
+            const int32_t out = ring_int32_pop(&r);
+            assert(out == next_out);
+            (void)out;
+            next_out++;
+        }
+    }
+    assert(ring_int32_len(&r) == (size_t)(next_in - next_out));
+    assert(*ring_int32_front(&r) == next_out);
+    assert(*ring_int32_peek(&r, 3) == next_out + 3);
+
+    // Bulk spans across the wrap point.
+    int32_t buf[1000];
+    for (int round = 0; round < 50; round++) {
+        for (int i = 0; i < 137; i++) buf[i] = next_in++;
+        ring_int32_push_many(&r, buf, 137);
+        const size_t got = ring_int32_pop_many(&r, buf, 150);
+        assert(got == 150);
+        for (size_t i = 0; i < got; i++, next_out++) assert(buf[i] == next_out);
+    }
+    const size_t rest = ring_int32_len(&r);
+    size_t got = ring_int32_pop_many(&r, buf, 1000);
+    assert(got == rest);
+    for (size_t i = 0; i < rest; i++, next_out++) assert(buf[i] == next_out);
+    assert(next_out == next_in);
+    got = ring_int32_pop_many(&r, buf, 10);
+    assert(got == 0);
+    (void)got;
+
+    ring_int32_clear(&r);
+    assert(ring_int32_empty(&r));
+    ring_int32_free(&r);
+}
+
+#define KEYED_GREATER(a, b) ((a).key > (b).key)
+
+PQ_DEFINE(keyed, keyed, KEYED_LESS)
+PQ_DEFINE(keyed_max, keyed, KEYED_GREATER)
+IPQ_DEFINE(u32, uint32_t, PQ_LESS_SCALAR)
+
+static void test_pq(void) {
+    pq_keyed q;
+    pq_keyed_init(&q);
+    assert(pq_keyed_empty(&q));
+
+    // Pseudo-random keys out in order, payload along for the ride.
+    uint32_t x = 12345;
+    for (int i = 0; i < 1000; i++) {
+        x = x * 1103515245u + 12345u;
+        pq_keyed_push(&q, (keyed){ (int)(x >> 16) % 500, i });
+    }
+    assert(pq_keyed_len(&q) == 1000);
+    int prev = -1;
+    for (int i = 0; i < 500; i++) {
+        const keyed k = pq_keyed_pop(&q);
+        assert(k.key >= prev);
+        prev = k.key;
+    }
+    const keyed smaller = pq_keyed_replace_top(&q, (keyed){ -1, -1 });
+    assert(smaller.key >= prev);
+    assert(pq_keyed_top(&q)->key == -1);
+    (void)smaller;
+    (void)prev;
+
+    keyed out[500];
+    const size_t drained = pq_keyed_drain(&q, out);
+    assert(drained == 500);
+    assert(out[0].key == -1);
+    for (int i = 1; i < 500; i++) assert(out[i].key >= out[i - 1].key);
+    (void)drained;
+    (void)out;
+    assert(pq_keyed_empty(&q));
+    pq_keyed_free(&q);
+
+    // Bounded: keep the 10 smallest of 0..999 pushed in scrambled order.
+    pq_keyed_max top;
+    pq_keyed_max_init(&top);
+    for (int i = 0; i < 1000; i++) {
+        const int key = (i * 337) % 1000;
+        pq_keyed_max_push_bounded(&top, (keyed){ key, i }, 10);
+    }
+    assert(pq_keyed_max_len(&top) == 10);
+    assert(pq_keyed_max_top(&top)->key == 9);
+    bool kept = pq_keyed_max_push_bounded(&top, (keyed){ 50, 0 }, 10);
+    assert(!kept);
+    kept = pq_keyed_max_push_bounded(&top, (keyed){ -5, 0 }, 10);
+    assert(kept);
+    (void)kept;
+    assert(pq_keyed_max_top(&top)->key == 8);
+    pq_keyed_max_free(&top);
+
+    // Indexed: decrease-key and re-insertion after pop.
+    ipq_u32 iq;
+    ipq_u32_init(&iq, 100);
+    for (uint32_t id = 0; id < 100; id++) ipq_u32_push(&iq, id, 1000 + id);
+    assert(ipq_u32_len(&iq) == 100);
+    ipq_u32_decrease(&iq, 77, 5);
+    bool changed = ipq_u32_push_or_decrease(&iq, 77, 6);
+    assert(!changed);
+    changed = ipq_u32_push_or_decrease(&iq, 40, 3);
+    assert(changed);
+    assert(ipq_u32_top(&iq) == 40);
+    uint32_t popped_id = ipq_u32_pop(&iq);
+    assert(popped_id == 40);
+    assert(ipq_u32_key(&iq, 40) == 3);
+    assert(!ipq_u32_contains(&iq, 40));
+    popped_id = ipq_u32_pop(&iq);
+    assert(popped_id == 77);
+    changed = ipq_u32_push_or_decrease(&iq, 40, 2000);
+    assert(changed);
+    (void)changed;
+    (void)popped_id;
+    uint32_t last = 0;
+    size_t popped = 0;
+    while (!ipq_u32_empty(&iq)) {
+        const uint32_t id = ipq_u32_pop(&iq);
+        assert(ipq_u32_key(&iq, id) >= last);
+        last = ipq_u32_key(&iq, id);
+        popped++;
+    }
+    assert(popped == 99);
+    assert(last == 2000);
+    (void)last;
+
+    ipq_u32_push(&iq, 3, 1);
+    ipq_u32_push(&iq, 4, 0);
+    ipq_u32_clear(&iq);
+    assert(ipq_u32_empty(&iq));
+    assert(!ipq_u32_contains(&iq, 3) && !ipq_u32_contains(&iq, 4));
+    ipq_u32_free(&iq);
+}
+
 static void test_stack(void) {
     stack* s = stack_new();
     assert(s != NULL);
@@ -75,6 +306,109 @@ static void test_stack(void) {
     stack_free(s);
 }
 
+SPSC_DEFINE(u64, uint64_t)
+MPMC_DEFINE(u64, uint64_t)
+
+enum { LFQ_ITEMS = 200000, LFQ_THREADS = 4 };
+
+static void* spsc_producer(void* arg) {
+    spsc_u64* q = arg;
+    for (uint64_t i = 1; i <= LFQ_ITEMS; i++) spsc_u64_push_wait(q, i);
+    spsc_u64_close(q);
+    return NULL;
+}
+
+typedef struct {
+    mpmc_u64* q;
+    uint64_t base;
+    uint64_t sum;
+    uint64_t count;
+} mpmc_worker;
+
+static void* mpmc_producer(void* arg) {
+    mpmc_worker* w = arg;
+    for (uint64_t i = 1; i <= LFQ_ITEMS; i++) mpmc_u64_push_wait(w->q, w->base + i);
+    return NULL;
+}
+
+static void* mpmc_consumer(void* arg) {
+    mpmc_worker* w = arg;
+    uint64_t v;
+    while (mpmc_u64_pop_wait(w->q, &v)) {
+        w->sum += v;
+        w->count++;
+    }
+    return NULL;
+}
+
+static void test_lockfree_queues(void) {
+    // SPSC: order preserved across threads.
+    spsc_u64 s;
+    spsc_u64_init(&s, 1000);
+    uint64_t v = 0;
+    bool ok = spsc_u64_try_pop(&s, &v);
+    assert(!ok);
+    for (uint64_t i = 0; i < 1024; i++) {
+        ok = spsc_u64_try_push(&s, i);
+        assert(ok);
+    }
+    ok = spsc_u64_try_push(&s, 0);
+    assert(!ok); // rounded up to 1024, now full
+    for (uint64_t i = 0; i < 1024; i++) {
+        ok = spsc_u64_try_pop(&s, &v);
+        assert(ok && v == i);
+    }
+
+    pthread_t producer;
+    int rc = pthread_create(&producer, NULL, spsc_producer, &s);
+    assert(rc == 0);
+    uint64_t expect = 1;
+    while (spsc_u64_pop_wait(&s, &v)) {
+        assert(v == expect);
+        expect++;
+    }
+    assert(expect == LFQ_ITEMS + 1);
+    (void)expect;
+    pthread_join(producer, NULL);
+    spsc_u64_free(&s);
+
+    // MPMC: nothing lost or duplicated.
+    mpmc_u64 m;
+    mpmc_u64_init(&m, 256);
+    ok = mpmc_u64_try_push(&m, 7);
+    assert(ok);
+    ok = mpmc_u64_try_pop(&m, &v);
+    assert(ok && v == 7);
+    ok = mpmc_u64_try_pop(&m, &v);
+    assert(!ok);
+    (void)ok;
+
+    pthread_t producers[LFQ_THREADS], consumers[LFQ_THREADS];
+    mpmc_worker pw[LFQ_THREADS], cw[LFQ_THREADS];
+    for (int i = 0; i < LFQ_THREADS; i++) {
+        pw[i] = (mpmc_worker){ &m, (uint64_t)i * 1000000000ULL, 0, 0 };
+        cw[i] = (mpmc_worker){ &m, 0, 0, 0 };
+        rc = pthread_create(&producers[i], NULL, mpmc_producer, &pw[i]);
+        assert(rc == 0);
+        rc = pthread_create(&consumers[i], NULL, mpmc_consumer, &cw[i]);
+        assert(rc == 0);
+    }
+    (void)rc;
+    for (int i = 0; i < LFQ_THREADS; i++) pthread_join(producers[i], NULL);
+    mpmc_u64_close(&m);
+
+    uint64_t sum = 0, count = 0, expected_sum = 0;
+    for (int i = 0; i < LFQ_THREADS; i++) {
+        pthread_join(consumers[i], NULL);
+        sum += cw[i].sum;
+        count += cw[i].count;
+        expected_sum += (uint64_t)LFQ_ITEMS * pw[i].base + (uint64_t)LFQ_ITEMS * (LFQ_ITEMS + 1) / 2;
+    }
+    assert(count == (uint64_t)LFQ_ITEMS * LFQ_THREADS);
+    assert(sum == expected_sum);
+    mpmc_u64_free(&m);
+}
+
 static void test_set(void) {
     set* s = set_new();
     assert(s != NULL);
@@ -94,6 +428,256 @@ static void test_set(void) {
     set_free(s);
 }
 
+static void test_hashmap(void) {
+    hm* map = hm_create();
+    assert(map != NULL);
+
+    // Enough keys to force several resizes and fingerprint collisions.
+    char key[32];
+    for (intptr_t i = 1; i <= 5000; i++) {
+        snprintf(key, sizeof(key), "k%ld", (long)i);
+        assert(hm_set(map, key, (void*)i) != NULL);
+    }
+    assert(hm_length(map) == 5000);
+    for (intptr_t i = 1; i <= 5000; i++) {
+        snprintf(key, sizeof(key), "k%ld", (long)i);
+        assert((intptr_t)hm_get(map, key) == i);
+    }
+    assert(hm_get(map, "k0") == NULL);
+    assert(hm_get(map, "missing") == NULL);
+
+    hm_set(map, "k7", (void*)(intptr_t)70);
+    assert((intptr_t)hm_get(map, "k7") == 70);
+    assert(hm_length(map) == 5000);
+
+    size_t seen = 0;
+    hmiterator it = hm_iterator(map);
+    while (hm_next(&it)) {
+        assert(it.key[0] == 'k');
+        seen++;
+    }
+    assert(seen == 5000);
+
+    hm_destroy(map);
+}
+
+static void test_numset(void) {
+    numset* s = numset_new();
+    assert(numset_size(s) == 0);
+
+    for (long long v = -10000; v <= 10000; v += 2) {
+        assert(numset_add(s, v * 1000003LL));
+    }
+    assert(!numset_add(s, 0));
+    assert(numset_size(s) == 10001);
+    for (long long v = -10000; v <= 10000; v++) {
+        assert(numset_contains(s, v * 1000003LL) == (v % 2 == 0));
+    }
+
+    long long sum = 0;
+    size_t seen = 0;
+    long long v;
+    numset_iter it = numset_iterator(s);
+    while (numset_next(&it, &v)) {
+        sum += v;
+        seen++;
+    }
+    assert(seen == 10001);
+    assert(sum == 0);
+
+    // Remove every other value, then churn to exercise tombstone reuse.
+    for (long long v2 = -10000; v2 <= 10000; v2 += 4) {
+        assert(numset_remove(s, v2 * 1000003LL));
+    }
+    assert(!numset_remove(s, 0));
+    assert(!numset_remove(s, 1));
+    assert(numset_size(s) == 5000);
+    for (long long v2 = -10000; v2 <= 10000; v2 += 2) {
+        assert(numset_contains(s, v2 * 1000003LL) == (v2 % 4 != 0));
+    }
+    for (int round = 0; round < 50; round++) {
+        for (long long x = 0; x < 1000; x++) assert(numset_add(s, x * 7 + 1));
+        for (long long x = 0; x < 1000; x++) assert(numset_remove(s, x * 7 + 1));
+    }
+    assert(numset_size(s) == 5000);
+
+    numset_clear(s);
+    assert(numset_size(s) == 0);
+    assert(!numset_contains(s, 2 * 1000003LL));
+
+    // Bulk insert: sorted with repeats.
+    long long sorted[] = {1, 1, 2, 3, 3, 3, 5, 8, 8};
+    numset_reserve(s, 100);
+    size_t added = numset_add_bulk(s, sorted, sizeof(sorted) / sizeof(sorted[0]));
+    assert(added == 5);
+    added = numset_add_bulk(s, sorted, 3);
+    assert(added == 0);
+    assert(numset_size(s) == 5);
+    (void)added;
+
+    numset_free(s);
+}
+
+static void test_intern(void) {
+    intern_pool* p = intern_new();
+    assert(intern_count(p) == 0);
+
+    const uint32_t a = intern(p, "alpha");
+    const uint32_t b = intern(p, "beta");
+    assert(a == 0 && b == 1); // dense, first-seen order
+    (void)a;
+    (void)b;
+    assert(intern(p, "alpha") == a);
+    assert(intern_n(p, "beta-gamma", 4) == b);
+    assert(intern_lookup(p, "gamma") == INTERN_NONE);
+    assert(intern_lookup_n(p, "alphabet", 5) == a);
+    assert(strcmp(intern_str(p, b), "beta") == 0);
+    assert(intern_strlen(p, a) == 5);
+    assert(intern_str(p, 2) == NULL);
+
+    // Enough to grow the table and spill over several arena chunks.
+    char name[32];
+    for (int i = 0; i < 20000; i++) {
+        snprintf(name, sizeof(name), "node-%d-padding-padding", i);
+        assert(intern(p, name) == (uint32_t)i + 2);
+    }
+    assert(intern_count(p) == 20002);
+    for (int i = 0; i < 20000; i++) {
+        snprintf(name, sizeof(name), "node-%d-padding-padding", i);
+        assert(strcmp(intern_str(p, (uint32_t)i + 2), name) == 0);
+    }
+    assert(strcmp(intern_str(p, a), "alpha") == 0); // stable after growth
+
+    // hm / set on top of the pool
+    hm* map = hm_create_interned(p);
+    const char* k = hm_set(map, "alpha", (void*)(intptr_t)1);
+    assert(k == intern_str(p, a));
+    (void)k;
+    hm_set(map, "delta", (void*)(intptr_t)2);
+    assert(intern_lookup(p, "delta") != INTERN_NONE);
+    assert((intptr_t)hm_get(map, "delta") == 2);
+    hm_destroy(map);
+
+    set* s = set_new_interned(p);
+    assert(set_add(s, "alpha"));
+    assert(!set_add(s, "alpha"));
+    assert(set_contains(s, "alpha"));
+    set_free(s);
+
+    // Keys outlive the containers.
+    assert(strcmp(intern_str(p, a), "alpha") == 0);
+    intern_free(p);
+}
+
+static void test_roaring(void) {
+    roaring* r = roaring_new();
+    assert(roaring_cardinality(r) == 0);
+
+    // Sparse values across chunks, including the top of the range.
+    assert(roaring_add(r, 5));
+    assert(!roaring_add(r, 5));
+    assert(roaring_add(r, 70000));
+    assert(roaring_add(r, UINT64_MAX));
+    assert(roaring_contains(r, 5));
+    assert(roaring_contains(r, UINT64_MAX));
+    assert(!roaring_contains(r, 6));
+    assert(roaring_cardinality(r) == 3);
+
+    // Dense chunk: array -> bitmap and back.
+    for (uint64_t v = 1u << 20; v < (1u << 20) + 10000; v += 2) {
+        assert(roaring_add(r, v));
+    }
+    assert(roaring_cardinality(r) == 5003);
+    for (uint64_t v = 1u << 20; v < (1u << 20) + 10000; v += 2) {
+        if (v % 4 == 0) assert(roaring_remove(r, v));
+    }
+    assert(roaring_cardinality(r) == 2503);
+    assert(!roaring_remove(r, 1u << 20));
+    assert(roaring_contains(r, (1u << 20) + 2));
+
+    // Ascending iteration.
+    uint64_t prev = 0, v;
+    size_t seen = 0;
+    roaring_iter it = roaring_iterator(r);
+    while (roaring_next(&it, &v)) {
+        assert(seen == 0 || v > prev);
+        prev = v;
+        seen++;
+    }
+    assert(seen == 2503);
+    assert(prev == UINT64_MAX);
+    (void)prev;
+    roaring_free(r);
+
+    // Ranges are stored as runs: ten million values in a few bytes each chunk.
+    roaring* a = roaring_new();
+    roaring_add_range(a, 1000, 10000999);
+    roaring_add_range(a, 5000, 6000); // already covered
+    roaring_add_range(a, 10001000, 10001000); // adjacent: merges
+    assert(roaring_cardinality(a) == 10000001);
+    assert(roaring_size_in_bytes(a) < 16 * 1024);
+    assert(roaring_contains(a, 1000) && roaring_contains(a, 10001000));
+    assert(!roaring_contains(a, 999) && !roaring_contains(a, 10001001));
+    assert(roaring_remove(a, 123456)); // splits a run
+    assert(!roaring_contains(a, 123456));
+    assert(roaring_contains(a, 123455) && roaring_contains(a, 123457));
+    assert(roaring_cardinality(a) == 10000000);
+
+    // Union / intersection against a reference bitmap over [0, 300000).
+    enum { N = 300000 };
+    static unsigned char ref_b[N], ref_c[N];
+    memset(ref_b, 0, sizeof(ref_b));
+    memset(ref_c, 0, sizeof(ref_c));
+    roaring* b = roaring_new();
+    roaring* c = roaring_new();
+    uint64_t rng = 42;
+    for (int i = 0; i < 60000; i++) {
+        rng = rng * 6364136223846793005ULL + 1442695040888963407ULL;
+        const uint64_t x = (rng >> 33) % N;
+        roaring_add(b, x);
+        ref_b[x] = 1;
+    }
+    roaring_add_range(c, 1000, 150000);
+    for (uint64_t x = 1000; x <= 150000; x++) ref_c[x] = 1;
+    for (uint64_t x = 200000; x < N; x += 3) {
+        roaring_add(c, x);
+        ref_c[x] = 1;
+    }
+
+    size_t both = 0, either = 0;
+    for (size_t x = 0; x < N; x++) {
+        both += ref_b[x] && ref_c[x];
+        either += ref_b[x] || ref_c[x];
+    }
+    assert(roaring_intersect_cardinality(b, c) == both);
+
+    roaring* u = roaring_new();
+    roaring_union_with(u, b);
+    roaring_union_with(u, c);
+    assert(roaring_cardinality(u) == either);
+    roaring_intersect_with(b, c);
+    assert(roaring_cardinality(b) == both);
+    for (uint64_t x = 0; x < N; x++) {
+        assert(roaring_contains(u, x) == (ref_b[x] || ref_c[x]));
+        assert(roaring_contains(b, x) == (ref_b[x] && ref_c[x]));
+    }
+
+    // optimize() never changes contents and only shrinks.
+    const size_t before = roaring_size_in_bytes(u);
+    roaring_optimize(u);
+    assert(roaring_size_in_bytes(u) <= before);
+    (void)before;
+    assert(roaring_cardinality(u) == either);
+    for (uint64_t x = 0; x < N; x++) {
+        assert(roaring_contains(u, x) == (ref_b[x] || ref_c[x]));
+    }
+
+    roaring_free(a);
+    roaring_free(b);
+    roaring_free(c);
+    roaring_free(u);
+}
+
 static void test_stringbuilder(void) {
     sb* b = sb_new();
     assert(b != NULL);
@@ -106,8 +690,58 @@ static void test_stringbuilder(void) {
     sb_append_int(b, 123);
 
     assert(strcmp(sb_str(b), "Hello World! 123") == 0);
+    // Still in the inline buffer.
+    assert(b->buf == b->small);
+
+    sb_clear(b);
+    assert(b->len == 0 && strcmp(sb_str(b), "") == 0);
+    const long ints[] = {0, 7, -7, 10, 99, 100, -12345, 1000000007, LONG_MAX, LONG_MIN};
+    char expect[32];
+    for (size_t i = 0; i < sizeof(ints) / sizeof(ints[0]); i++) {
+        sb_clear(b);
+        sb_append_int(b, ints[i]);
+        snprintf(expect, sizeof(expect), "%ld", ints[i]);
+        assert(strcmp(sb_str(b), expect) == 0);
+    }
+
+    // Growing out of the inline buffer keeps the contents.
+    sb_clear(b);
+    for (int i = 0; i < 100; i++) sb_appendf(b, "%d,%d;", i, -i);
+    assert(b->buf != b->small);
+    assert(strncmp(sb_str(b), "0,0;1,-1;2,-2;", 14) == 0);
+    assert(strcmp(sb_str(b) + b->len - 7, "99,-99;") == 0);
 
+    // Clearing keeps the heap buffer.
+    const char* heap = b->buf;
+    sb_clear(b);
+    sb_appendf(b, "%s-%05d", "key", 42);
+    assert(b->buf == heap && strcmp(sb_str(b), "key-00042") == 0);
+    (void)heap;
     sb_free(b);
+
+    sb local;
+    sb_init(&local);
+    sb_reserve(&local, 1000);
+    assert(local.cap > 1000);
+    sb_append_n(&local, "abcdef", 3);
+    sb_appendf(&local, "%c%c", 'x', 'y');
+    char* owned = sb_detach(&local);
+    assert(strcmp(owned, "abcxy") == 0);
+    assert(local.len == 0 && local.buf == local.small);
+    free(owned);
+
+    sb_appendf(&local, "%s", "short");
+    owned = sb_detach(&local);
+    assert(strcmp(owned, "short") == 0);
+    free(owned);
+    sb_release(&local);
+
+    // Zeroed rather than initialised: appends still work, off the heap.
+    sb zeroed = {0};
+    sb_append(&zeroed, "abc");
+    sb_append_int(&zeroed, -5);
+    assert(strcmp(sb_str(&zeroed), "abc-5") == 0);
+    sb_release(&zeroed);
 }
 
 static void test_grid(void) {
@@ -135,17 +769,695 @@ static void test_grid(void) {
     assert(grid_get(g, 1, 1) == 'X');
 
     grid_free(g);
+
+    // Tiled: partial edge tiles on both axes.
+    const int w = 150, h = 70;
+    Grid* rm = grid_new(w, h);
+    for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) grid_set(rm, x, y, (char)('a' + (x * 7 + y * 3) % 26));
+    }
+    Grid* tiled = grid_convert(rm, GRID_TILED);
+    assert(tiled->layout == GRID_TILED && tiled->tiles_x == 3);
+    for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) assert(grid_get(tiled, x, y) == grid_get(rm, x, y));
+    }
+    assert(grid_get(tiled, w, 0) == 0 && grid_get(tiled, 0, h) == 0);
+    // Vertical neighbours inside a tile are one tile row apart.
+    assert(grid_index(tiled, 5, 6) - grid_index(tiled, 5, 5) == GRID_TILE);
+    grid_set(tiled, 149, 69, '!');
+    assert(grid_get(tiled, 149, 69) == '!');
+
+    // The iterator visits each cell once, in storage order.
+    for (int pass = 0; pass < 2; pass++) {
+        Grid* it_grid = pass ? tiled : rm;
+        unsigned char* seen = calloc((size_t)w * h, 1);
+        size_t visits = 0;
+        const char* prev = NULL;
+        grid_iter it = grid_iterator(it_grid);
+        while (grid_next(&it)) {
+            assert(it.cell == it_grid->cells + grid_index(it_grid, it.x, it.y));
+            assert(!prev || it.cell > prev);
+            prev = it.cell;
+            seen[it.y * w + it.x]++;
+            visits++;
+        }
+        (void)prev;
+        assert(!grid_next(&it));
+        assert(visits == (size_t)w * h);
+        for (int i = 0; i < w * h; i++) assert(seen[i] == 1);
+        free(seen);
+    }
+
+    // The other grid types read either layout.
+    padgrid* pg = padgrid_from_grid(tiled, 1, '#');
+    bitgrid* bg = bitgrid_from_grid(tiled, 'q');
+    for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) {
+            assert(padgrid_get(pg, x, y) == grid_get(tiled, x, y));
+            assert(bitgrid_get(bg, x, y) == (grid_get(tiled, x, y) == 'q'));
+        }
+    }
+    padgrid_free(pg);
+    bitgrid_free(bg);
+
+    Grid* back = grid_convert(tiled, GRID_ROW_MAJOR);
+    assert(back->layout == GRID_ROW_MAJOR);
+    assert(grid_get(back, 149, 69) == '!' && grid_get(back, 3, 40) == grid_get(rm, 3, 40));
+    grid_free(back);
+    grid_free(tiled);
+    grid_free(rm);
+}
+
+static void test_bitgrid(void) {
+    // 130 wide so rows span three words and neighbours cross word edges.
+    const int w = 130, h = 9;
+    Grid* g = grid_new(w, h);
+    uint32_t x = 7;
+    for (int i = 0; i < w * h; i++) {
+        x = x * 1103515245u + 12345u;
+        g->cells[i] = (x >> 16) % 3 ? '@' : '.';
+    }
+
+    bitgrid* b = bitgrid_from_grid(g, '@');
+    assert(b->width == w && b->height == h && b->words == 3);
+    size_t set = 0;
+    for (int y = 0; y < h; y++) {
+        for (int cx = 0; cx < w; cx++) {
+            assert(bitgrid_get(b, cx, y) == (grid_get(g, cx, y) == '@'));
+            set += grid_get(g, cx, y) == '@';
+        }
+    }
+    assert(bitgrid_count(b) == set);
+
+    uint8_t* c8 = malloc((size_t)w * h);
+    uint8_t* c4 = malloc((size_t)w * h);
+    bitgrid_neighbors8(b, c8);
+    bitgrid_neighbors4(b, c4);
+    bitgrid* few8 = bitgrid_new(w, h);
+    bitgrid* few4 = bitgrid_new(w, h);
+    bitgrid_fewer8(b, 4, few8);
+    bitgrid_fewer4(b, 2, few4);
+    for (int y = 0; y < h; y++) {
+        for (int cx = 0; cx < w; cx++) {
+            int n8 = 0, n4 = 0;
+            for (int dy = -1; dy <= 1; dy++) {
+                for (int dx = -1; dx <= 1; dx++) {
+                    if ((dx || dy) && grid_get(g, cx + dx, y + dy) == '@') {
+                        n8++;
+                        if (!dx || !dy) n4++;
+                    }
+                }
+            }
+            assert(c8[y * w + cx] == n8);
+            assert(c4[y * w + cx] == n4);
+            assert(bitgrid_get(few8, cx, y) == (n8 < 4));
+            assert(bitgrid_get(few4, cx, y) == (n4 < 2));
+        }
+    }
+    // Bits past the width stay clear.
+    assert(bitgrid_row(few8, 0)[2] >> (w - 128) == 0);
+
+    bitgrid_and(few8, b);
+    bitgrid_and_not(b, few8);
+    for (int y = 0; y < h; y++) {
+        for (int cx = 0; cx < w; cx++) {
+            assert(!(bitgrid_get(b, cx, y) && bitgrid_get(few8, cx, y)));
+        }
+    }
+    bitgrid_set(b, 129, 8, true);
+    assert(bitgrid_get(b, 129, 8));
+    bitgrid_set(b, 129, 8, false);
+    assert(!bitgrid_get(b, 129, 8));
+
+    free(c8);
+    free(c4);
+    bitgrid_free(few8);
+    bitgrid_free(few4);
+    bitgrid_free(b);
+    grid_free(g);
+}
+
+static void test_padgrid(void) {
+    padgrid* g = padgrid_from_string("S.#\n..E\n", 2, '#');
+    assert(g != NULL);
+    assert(g->width == 3 && g->height == 2 && g->stride == 7);
+    assert(padgrid_get(g, 0, 0) == 'S');
+    assert(padgrid_get(g, 2, 1) == 'E');
+    // Two rings of sentinels all round.
+    assert(padgrid_get(g, -1, 0) == '#' && padgrid_get(g, -2, -2) == '#');
+    assert(padgrid_get(g, 4, 3) == '#' && padgrid_get(g, 3, 1) == '#');
+    assert(!padgrid_in_bounds(g, 3, 0) && padgrid_in_bounds(g, 2, 1));
+
+    const ptrdiff_t e = padgrid_find(g, 'E');
+    assert(e == padgrid_index(g, 2, 1));
+    assert(padgrid_point(g, e).x == 2 && padgrid_point(g, e).y == 1);
+    assert(padgrid_find(g, 'Z') == -1);
+
+    // Offsets agree with DIRS4/DIRS8.
+    for (int d = 0; d < 4; d++) {
+        assert(g->cells[e + g->dirs4[d]] == padgrid_get(g, 2 + DIRS4[d].x, 1 + DIRS4[d].y));
+    }
+    int walls = 0;
+    for (int d = 0; d < 8; d++) {
+        assert(e + g->dirs8[d] == padgrid_index(g, 2 + DIRS8[d].x, 1 + DIRS8[d].y));
+        walls += g->cells[e + g->dirs8[d]] == '#';
+    }
+    assert(walls == 6);
+
+    padgrid_set(g, 1, 1, 'x');
+    assert(padgrid_get(g, 1, 1) == 'x');
+    padgrid_free(g);
+
+    padgrid* empty = padgrid_new(4, 4, 1, '@');
+    assert(padgrid_get(empty, 3, 3) == 0 && padgrid_get(empty, 4, 3) == '@');
+    padgrid_free(empty);
+    assert(padgrid_new(0, 4, 1, '#') == NULL);
+}
+
+static void test_grid_bfs(void) {
+    padgrid* g = padgrid_from_string(
+        "S..#....\n"
+        ".#.#.##.\n"
+        ".#...#E.\n"
+        ".####.#.\n"
+        "......#x\n", 1, '#');
+    const ptrdiff_t s = padgrid_find(g, 'S');
+    const ptrdiff_t e = padgrid_find(g, 'E');
+
+    grid_bfs bfs;
+    grid_bfs_init(&bfs, g, "#x", GRID_BFS_DIST | GRID_BFS_PATH);
+    int dist = grid_bfs_run(&bfs, &s, 1, e);
+    assert(dist == 14);
+    assert(grid_bfs_dist(&bfs, e) == 14);
+    assert(grid_bfs_dist(&bfs, padgrid_index(g, 2, 2)) == 4);
+
+    ptrdiff_t path[64];
+    const size_t len = grid_bfs_path(&bfs, e, path, 64);
+    assert(len == 15);
+    assert(path[0] == s && path[14] == e);
+    (void)len;
+    for (int i = 1; i < 15; i++) {
+        const Point a = padgrid_point(g, path[i - 1]);
+        const Point b = padgrid_point(g, path[i]);
+        assert(abs(a.x - b.x) + abs(a.y - b.y) == 1);
+        assert(padgrid_get(g, b.x, b.y) != '#');
+        (void)a;
+        (void)b;
+    }
+    assert(grid_bfs_path(&bfs, e, path, 3) == 15);  // too small: length only
+
+    // Flood everything; 'x' is blocked, so it is never reached.
+    grid_bfs_reset(&bfs);
+    dist = grid_bfs_run(&bfs, &s, 1, -1);
+    assert(dist == 14);
+    assert(grid_bfs_count(&bfs) == 26);
+    assert(!grid_bfs_visited(&bfs, padgrid_index(g, 7, 4)));
+    assert(grid_bfs_dist(&bfs, padgrid_index(g, 7, 4)) == -1);
+    assert(grid_bfs_path(&bfs, padgrid_index(g, 7, 4), path, 64) == 0);
+
+    // Multi-source: distance to the nearest source; blocked sources ignored.
+    grid_bfs_reset(&bfs);
+    const ptrdiff_t sources[3] = { s, padgrid_index(g, 7, 0), padgrid_index(g, 3, 0) };
+    dist = grid_bfs_run(&bfs, sources, 3, e);
+    assert(dist == 3);
+    assert(grid_bfs_dist(&bfs, padgrid_index(g, 7, 0)) == 0);
+    grid_bfs_free(&bfs);
+
+    // Unreachable goal, and no optional arrays.
+    padgrid* walled = padgrid_from_string("S#E\n", 1, '#');
+    grid_bfs plain;
+    grid_bfs_init(&plain, walled, "#", 0);
+    const ptrdiff_t ws = padgrid_find(walled, 'S');
+    dist = grid_bfs_run(&plain, &ws, 1, padgrid_find(walled, 'E'));
+    assert(dist == -1);
+    (void)dist;
+    assert(grid_bfs_count(&plain) == 1);
+    grid_bfs_free(&plain);
+    padgrid_free(walled);
+    padgrid_free(g);
+}
+
+static void test_podmap(void) {
+    // Map: Point -> int
+    podmap* m = podmap_new(sizeof(Point), sizeof(int));
+    assert(podmap_size(m) == 0);
+
+    const Point a = {1, 2};
+    const Point b = {-3, 7};
+    int v = 10;
+    bool inserted = false;
+    podmap_put(m, &a, &v, &inserted);
+    assert(inserted);
+    v = 20;
+    podmap_put(m, &b, &v, NULL);
+    assert(podmap_size(m) == 2);
+    assert(*(int*)podmap_get(m, &a) == 10);
+    assert(*(int*)podmap_get(m, &b) == 20);
+
+    // Overwrite and in-place update
+    v = 11;
+    podmap_put(m, &a, &v, &inserted);
+    assert(!inserted);
+    (*(int*)podmap_get(m, &a))++;
+    assert(*(int*)podmap_get(m, &a) == 12);
+
+    int out = 0;
+    const bool removed = podmap_remove(m, &a, &out);
+    assert(removed && out == 12);
+    (void)removed;
+    (void)out;
+    assert(!podmap_contains(m, &a));
+    assert(!podmap_remove(m, &a, NULL));
+    assert(podmap_size(m) == 1);
+
+    podmap_clear(m);
+    assert(podmap_size(m) == 0);
+    assert(podmap_get(m, &b) == NULL);
+    podmap_free(m);
+
+    // Set of u64 under heavy insert/remove churn, checked against a bitmap.
+    enum { N = 4096 };
+    static unsigned char present[N];
+    memset(present, 0, sizeof(present));
+    podmap* s = podmap_new(sizeof(uint64_t), 0);
+    podmap_reserve(s, 1000);
+    size_t expected = 0;
+    uint64_t rng = 12345;
+    for (int i = 0; i < 200000; i++) {
+        rng = rng * 6364136223846793005ULL + 1442695040888963407ULL;
+        const uint64_t key = (rng >> 33) % N;
+        if ((rng >> 20) & 1) {
+            assert(podmap_add(s, &key) == !present[key]);
+            if (!present[key]) expected++;
+            present[key] = 1;
+        } else {
+            assert(podmap_remove(s, &key, NULL) == (bool)present[key]);
+            if (present[key]) expected--;
+            present[key] = 0;
+        }
+    }
+    assert(podmap_size(s) == expected);
+    for (uint64_t k = 0; k < N; k++) {
+        assert(podmap_contains(s, &k) == (bool)present[k]);
+    }
+
+    size_t seen = 0;
+    podmap_iter it = podmap_iterator(s);
+    while (podmap_next(&it)) {
+        assert(present[*(const uint64_t*)it.key]);
+        assert(it.value == NULL);
+        seen++;
+    }
+    assert(seen == expected);
+    podmap_free(s);
+}
+
+static void test_pointset(void) {
+    // Keys round-trip, negatives included.
+    const Point pts[4] = { {0, 0}, {-1, 5}, {INT32_MIN, INT32_MAX}, {123456, -654321} };
+    for (int i = 0; i < 4; i++) {
+        const Point back = point_from_key(point_key(pts[i]));
+        assert(back.x == pts[i].x && back.y == pts[i].y);
+        (void)back;
+    }
+    assert(point_key((Point){1, 0}) != point_key((Point){0, 1}));
+    const Point3 p3[3] = { {0, 0, 0}, {-1, -1048576, 1048575}, {99999, -5, 42} };
+    for (int i = 0; i < 3; i++) {
+        const Point3 back = point3_from_key(point3_key(p3[i]));
+        assert(back.x == p3[i].x && back.y == p3[i].y && back.z == p3[i].z);
+        (void)back;
+    }
+    assert(point_key_hash(1) != point_key_hash(2));
+
+    pointset* s = pointset_new();
+    for (int y = -50; y < 50; y++) {
+        for (int x = -50; x < 50; x += 2) pointset_add(s, (Point){x, y});
+    }
+    assert(pointset_size(s) == 5000);
+    bool changed = pointset_add(s, (Point){-50, -50});
+    assert(!changed);
+    assert(pointset_contains(s, (Point){48, 49}));
+    assert(!pointset_contains(s, (Point){49, 49}));
+    changed = pointset_remove(s, (Point){0, 0});
+    assert(changed);
+    assert(!pointset_contains(s, (Point){0, 0}));
+
+    numset_iter it = numset_iterator(s);
+    Point p;
+    size_t seen = 0;
+    while (pointset_next(&it, &p)) {
+        assert((p.x & 1) == 0 && p.y >= -50 && p.y < 50);
+        seen++;
+    }
+    assert(seen == 4999);
+
+    pointset_clear(s);
+    changed = pointset_add3(s, (Point3){1, 2, 3});
+    assert(changed);
+    assert(pointset_contains3(s, (Point3){1, 2, 3}));
+    assert(!pointset_contains3(s, (Point3){3, 2, 1}));
+    it = numset_iterator(s);
+    Point3 q;
+    const bool more = pointset_next3(&it, &q);
+    assert(more && q.x == 1 && q.y == 2 && q.z == 3);
+    (void)more;
+    (void)q;
+    changed = pointset_remove3(s, (Point3){1, 2, 3});
+    assert(changed);
+    pointset_free(s);
+
+    pointmap* m = pointmap_new(sizeof(int));
+    for (int i = 0; i < 1000; i++) {
+        const int v = i * 3;
+        bool inserted = false;
+        pointmap_put(m, (Point){i, -i}, &v, &inserted);
+        assert(inserted);
+    }
+    assert(pointmap_size(m) == 1000);
+    assert(*(int*)pointmap_get(m, (Point){10, -10}) == 30);
+    assert(pointmap_get(m, (Point){10, 10}) == NULL);
+    int out = 0;
+    changed = pointmap_remove(m, (Point){7, -7}, &out);
+    assert(changed && out == 21);
+    (void)out;
+    podmap_iter mit = podmap_iterator(m);
+    while (podmap_next(&mit)) {
+        const Point at = pointmap_iter_point(&mit);
+        assert(at.x == -at.y && *(int*)mit.value == at.x * 3);
+        (void)at;
+    }
+    pointmap_free(m);
+
+    pointmap* m3 = pointmap_new(sizeof(long long));
+    const long long big = 1LL << 40;
+    pointmap_put3(m3, (Point3){-3, 4, -5}, &big, NULL);
+    assert(*(long long*)pointmap_get3(m3, (Point3){-3, 4, -5}) == big);
+    mit = podmap_iterator(m3);
+    const bool found = podmap_next(&mit);
+    assert(found && pointmap_iter_point3(&mit).z == -5);
+    (void)found;
+    changed = pointmap_remove3(m3, (Point3){-3, 4, -5}, NULL);
+    assert(changed);
+    (void)changed;
+    assert(pointmap_get3(m3, (Point3){-3, 4, -5}) == NULL);
+    pointmap_free(m3);
+}
+
+#define DSU_THREADS 4
+#define DSU_N 100000
+
+typedef struct {
+    dsu_atomic* d;
+    uint32_t first;
+} dsu_worker;
+
+/* Each thread links every element to its successor mod 10, from its own
+ * starting point, so the threads race on the same roots. */
+static void* dsu_unite(void* arg) {
+    const dsu_worker* w = arg;
+    for (uint32_t k = 0; k + 10 < DSU_N; k++) {
+        const uint32_t i = (w->first + k * 7919u) % (DSU_N - 10);
+        dsu_atomic_union(w->d, i, i + 10);
+    }
+    return NULL;
+}
+
+static void test_dsu(void) {
+    dsu* d = dsu_new(10);
+    assert(dsu_components(d) == 10);
+    bool merged = dsu_union(d, 0, 1);
+    assert(merged);
+    merged = dsu_union(d, 1, 2);
+    assert(merged);
+    merged = dsu_union(d, 2, 0);
+    assert(!merged);
+    merged = dsu_union(d, 5, 6);
+    assert(merged);
+    (void)merged;
+    assert(dsu_same(d, 0, 2) && !dsu_same(d, 0, 5));
+    assert(dsu_size(d, 1) == 3 && dsu_size(d, 6) == 2 && dsu_size(d, 9) == 1);
+    assert(dsu_components(d) == 7);
+
+    size_t top[4];
+    size_t n_top = dsu_top_sizes(d, 3, top);
+    assert(n_top == 3);
+    assert(top[0] == 3 && top[1] == 2 && top[2] == 1);
+    n_top = dsu_top_sizes(d, 0, top);
+    assert(n_top == 0);
+    dsu_reset(d);
+    assert(dsu_components(d) == 10 && !dsu_same(d, 0, 1));
+    dsu_free(d);
+
+    // A long chain: find must not recurse, and halving flattens it.
+    d = dsu_new(1000000);
+    for (uint32_t i = 1; i < 1000000; i++) {
+        d->parent[i] = i - 1;
+    }
+    d->size[0] = 1000000;
+    const uint32_t root = dsu_find(d, 999999);
+    assert(root == 0);
+    assert(d->parent[999999] == 999997);
+    (void)root;
+    dsu_free(d);
+
+    dsu_atomic* a = dsu_atomic_new(DSU_N);
+    pthread_t threads[DSU_THREADS];
+    dsu_worker workers[DSU_THREADS];
+    for (int t = 0; t < DSU_THREADS; t++) {
+        workers[t] = (dsu_worker){a, (uint32_t)t * 12345u};
+        const int rc = pthread_create(&threads[t], NULL, dsu_unite, &workers[t]);
+        assert(rc == 0);
+        (void)rc;
+    }
+    for (int t = 0; t < DSU_THREADS; t++) pthread_join(threads[t], NULL);
+
+    assert(dsu_atomic_components(a) == 10);
+    for (uint32_t i = 0; i < DSU_N; i++) {
+        assert(dsu_atomic_find(a, i) == i % 10);
+    }
+    assert(dsu_atomic_same(a, 3, 99993) && !dsu_atomic_same(a, 3, 4));
+    n_top = dsu_atomic_top_sizes(a, 4, top);
+    assert(n_top == 4);
+    for (int i = 0; i < 4; i++) assert(top[i] == DSU_N / 10);
+    (void)n_top;
+    dsu_atomic_reset(a);
+    assert(dsu_atomic_components(a) == DSU_N);
+    dsu_atomic_free(a);
+}
+
+/* Membership of x in a set, by definition rather than by search. */
+static bool interval_brute(const intervalset* s, int64_t x) {
+    for (size_t i = 0; i < s->runs.len; i++) {
+        if (s->runs.data[i].lo <= x && x <= s->runs.data[i].hi) return true;
+    }
+    return false;
+}
+
+static void test_intervalset(void) {
+    intervalset a, b, out;
+    intervalset_init(&a);
+    intervalset_init(&b);
+    intervalset_init(&out);
+    (void)interval_brute; // the oracle is only called from asserts
+
+    const interval raw[] = { {10, 14}, {3, 5}, {16, 20}, {12, 18}, {6, 6}, {30, 30} };
+    intervalset_add_bulk(&a, raw, sizeof(raw) / sizeof(raw[0]));
+    assert(!a.normalized);
+    intervalset_normalize(&a);
+    // [3,5] and [6,6] touch; [10,14], [12,18] and [16,20] overlap.
+    assert(intervalset_runs(&a) == 3);
+    assert(a.runs.data[0].lo == 3 && a.runs.data[0].hi == 6);
+    assert(a.runs.data[1].lo == 10 && a.runs.data[1].hi == 20);
+    assert(a.runs.data[2].lo == 30 && a.runs.data[2].hi == 30);
+    assert(intervalset_covered(&a) == 4 + 11 + 1);
+    assert(intervalset_contains(&a, 3) && intervalset_contains(&a, 20));
+    assert(!intervalset_contains(&a, 7) && !intervalset_contains(&a, 31));
+
+    const int64_t ids[] = {1, 3, 5, 8, 9, 10, 10, 21, 30, 40};
+    bool hits[10];
+    const size_t members = intervalset_contains_sorted(&a, ids, 10, hits);
+    assert(members == 5);
+    for (int i = 0; i < 10; i++) assert(hits[i] == intervalset_contains(&a, ids[i]));
+    (void)members;
+
+    intervalset_add(&b, 5, 12);
+    intervalset_add(&b, 25, 35);
+    intervalset_add(&b, -100, -50);
+    intervalset_normalize(&b);
+
+    intervalset_union(&out, &a, &b);
+    assert(intervalset_runs(&out) == 3 && intervalset_covered(&out) == 51 + 18 + 11);
+    for (int64_t x = -120; x < 50; x++) {
+        assert(intervalset_contains(&out, x) == (interval_brute(&a, x) || interval_brute(&b, x)));
+    }
+    intervalset_intersect(&out, &a, &b);
+    assert(intervalset_covered(&out) == 2 + 3 + 1);
+    for (int64_t x = -120; x < 50; x++) {
+        assert(intervalset_contains(&out, x) == (interval_brute(&a, x) && interval_brute(&b, x)));
+    }
+    intervalset_difference(&out, &a, &b);
+    assert(intervalset_covered(&out) == 2 + 8);
+    for (int64_t x = -120; x < 50; x++) {
+        assert(intervalset_contains(&out, x) == (interval_brute(&a, x) && !interval_brute(&b, x)));
+    }
+
+    // Randomised against the definition.
+    uint64_t seed = 12345;
+    for (int round = 0; round < 50; round++) {
+        intervalset_clear(&a);
+        intervalset_clear(&b);
+        for (int k = 0; k < 20; k++) {
+            seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+            const int64_t lo = (int64_t)(seed >> 33) % 200;
+            intervalset_add(k & 1 ? &a : &b, lo, lo + (int64_t)(seed >> 58));
+        }
+        intervalset_normalize(&a);
+        intervalset_normalize(&b);
+        intervalset_difference(&out, &a, &b);
+        for (int64_t x = -1; x < 270; x++) {
+            assert(intervalset_contains(&out, x) == (interval_brute(&a, x) && !interval_brute(&b, x)));
+        }
+        intervalset_intersect(&out, &a, &b);
+        for (int64_t x = -1; x < 270; x++) {
+            assert(intervalset_contains(&out, x) == (interval_brute(&a, x) && interval_brute(&b, x)));
+        }
+    }
+
+    // Extremes don't overflow.
+    intervalset_clear(&a);
+    intervalset_add(&a, INT64_MAX - 1, INT64_MAX);
+    intervalset_add(&a, INT64_MIN, INT64_MIN + 1);
+    intervalset_normalize(&a);
+    assert(intervalset_runs(&a) == 2 && intervalset_covered(&a) == 4);
+    intervalset_clear(&b);
+    intervalset_add(&b, INT64_MAX, INT64_MAX);
+    intervalset_normalize(&b);
+    intervalset_difference(&out, &a, &b);
+    assert(intervalset_covered(&out) == 3 && !intervalset_contains(&out, INT64_MAX));
+
+    intervalset_free(&a);
+    intervalset_free(&b);
+    intervalset_free(&out);
+}
+
+/* Bitset contents equal a bool array's. */
+static void bitset_check(const bitset* b, const bool* ref) {
+    size_t count = 0;
+    for (size_t i = 0; i < b->nbits; i++) {
+        assert(bitset_test(b, i) == ref[i]);
+        count += ref[i];
+    }
+    assert(bitset_count(b) == count);
+    assert(bitset_any(b) == (count > 0));
+}
+
+static void test_bitset(void) {
+    const size_t sizes[] = {1, 63, 64, 65, 130, 300};
+    uint64_t seed = 99;
+    for (size_t si = 0; si < sizeof(sizes) / sizeof(sizes[0]); si++) {
+        const size_t n = sizes[si];
+        bitset* a = bitset_new(n);
+        bitset* b = bitset_new(n);
+        bool* ra = calloc(n, sizeof(bool));
+        bool* rb = calloc(n, sizeof(bool));
+        bool* tmp = calloc(n, sizeof(bool));
+        bitset_check(a, ra);
+
+        for (int round = 0; round < 40; round++) {
+            for (size_t i = 0; i < n; i++) {
+                seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+                ra[i] = (seed >> 60) < 5;
+                rb[i] = (seed >> 40) & 1;
+                bitset_assign(a, i, ra[i]);
+                bitset_assign(b, i, rb[i]);
+            }
+            bitset_check(a, ra);
+
+            // find-next-set walks exactly the set bits.
+            size_t at = bitset_next_set(a, 0);
+            for (size_t i = 0; i < n; i++) {
+                if (!ra[i]) continue;
+                assert(at == i);
+                at = bitset_next_set(a, i + 1);
+            }
+            assert(at == SIZE_MAX);
+            (void)at;
+
+            const size_t k = (size_t)(seed >> 20) % (n + 70);
+            if (round & 1) {
+                bitset_shl(a, k);
+                for (size_t i = n; i-- > 0;) ra[i] = i >= k && ra[i - k];
+            } else {
+                bitset_shr(a, k);
+                for (size_t i = 0; i < n; i++) ra[i] = i + k < n && ra[i + k];
+            }
+            bitset_check(a, ra);
+
+            switch (round % 4) {
+            case 0:
+                bitset_and(a, b);
+                for (size_t i = 0; i < n; i++) ra[i] = ra[i] && rb[i];
+                break;
+            case 1:
+                bitset_or(a, b);
+                for (size_t i = 0; i < n; i++) ra[i] = ra[i] || rb[i];
+                break;
+            case 2:
+                bitset_xor(a, b);
+                for (size_t i = 0; i < n; i++) ra[i] = ra[i] != rb[i];
+                break;
+            default:
+                bitset_and_not(a, b);
+                for (size_t i = 0; i < n; i++) ra[i] = ra[i] && !rb[i];
+                break;
+            }
+            bitset_check(a, ra);
+        }
+
+        bitset_set_all(a);
+        for (size_t i = 0; i < n; i++) tmp[i] = true;
+        bitset_check(a, tmp);
+        bitset_shl(a, 1);
+        assert(bitset_count(a) == n - 1 && !bitset_test(a, 0));
+        bitset_copy(b, a);
+        bitset_clear(b, n - 1);
+        assert(bitset_count(b) == (n > 1 ? n - 2 : 0));
+        bitset_clear_all(a);
+        assert(!bitset_any(a) && bitset_next_set(a, 0) == SIZE_MAX);
+
+        bitset_free(a);
+        bitset_free(b);
+        free(ra);
+        free(rb);
+        free(tmp);
+    }
 }
 
 int main(void) {
     printf("Running container tests...\n");
 
     test_vector();
+    test_typed_vec();
     test_queue();
+    test_ring();
+    test_pq();
+    test_lockfree_queues();
     test_stack();
     test_set();
+    test_hashmap();
+    test_numset();
+    test_intern();
+    test_roaring();
     test_stringbuilder();
     test_grid();
+    test_bitgrid();
+    test_padgrid();
+    test_grid_bfs();
+    test_podmap();
+    test_pointset();
+    test_dsu();
+    test_intervalset();
+    test_bitset();
 
     printf("All container tests passed.\n");
     return 0;
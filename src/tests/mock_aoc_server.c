@@ -0,0 +1,411 @@
+#define _GNU_SOURCE // strcasestr on glibc
+
+#include "tests/mock_aoc_server.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+
+#define MOCK_MAX_CONNS 64
+#define MOCK_MAX_REQUEST 8192
+
+typedef struct {
+    int fd;
+    size_t len;
+    char buf[MOCK_MAX_REQUEST];
+} mock_conn;
+
+struct MockAocServer {
+    int listen_fd;
+    int wake_pipe[2];
+    char url[64];
+    pthread_t thread;
+
+    pthread_mutex_t lock;
+    size_t input_size;
+    int cooldown;          // seconds locked out after a wrong answer, 0 = off
+    double locked_until;   // monotonic seconds
+    size_t connections;
+    size_t requests;
+
+    mock_conn* conns[MOCK_MAX_CONNS];
+};
+
+static const char* HTML_RIGHT =
+    "<!DOCTYPE html><html><body><main>\n"
+    "<article><p>That's the right answer!  You are one gold star closer to "
+    "decorating the North Pole. <a href=\"/2025\">[Return to Advent Calendar]</a></p></article>\n"
+    "</main></body></html>\n";
+
+static const char* HTML_WRONG =
+    "<!DOCTYPE html><html><body><main>\n"
+    "<article><p>That's not the right answer; your answer is too low.  If you're "
+    "stuck, make sure you're using the full input data. Please wait one minute "
+    "before trying again. <a href=\"/2025/day/1\">[Return to Day 1]</a></p></article>\n"
+    "</main></body></html>\n";
+
+static const char* HTML_WAIT =
+    "<!DOCTYPE html><html><body><main>\n"
+    "<article><p>You gave an answer too recently; you have to wait after "
+    "submitting an answer before trying again.  You have 4m 32s left to wait. "
+    "<a href=\"/2025/day/1\">[Return to Day 1]</a></p></article>\n"
+    "</main></body></html>\n";
+
+static const char* HTML_DONE =
+    "<!DOCTYPE html><html><body><main>\n"
+    "<article><p>You don't seem to be solving the right level.  Did you already "
+    "complete it? <a href=\"/2025/day/1\">[Return to Day 1]</a></p></article>\n"
+    "</main></body></html>\n";
+
+static const char* HTML_OTHER =
+    "<!DOCTYPE html><html><body><main>\n"
+    "<article><p>Something unexpected happened.</p></article>\n"
+    "</main></body></html>\n";
+
+static const char* HTML_WRONG_COOLDOWN =
+    "<!DOCTYPE html><html><body><main>\n"
+    "<article><p>That's not the right answer.  Please wait %d seconds "
+    "before trying again. <a href=\"/2025/day/1\">[Return to Day 1]</a></p></article>\n"
+    "</main></body></html>\n";
+
+static const char* HTML_WAIT_COOLDOWN =
+    "<!DOCTYPE html><html><body><main>\n"
+    "<article><p>You gave an answer too recently; you have to wait after "
+    "submitting an answer before trying again.  You have %ds left to wait. "
+    "<a href=\"/2025/day/1\">[Return to Day 1]</a></p></article>\n"
+    "</main></body></html>\n";
+
+static double mono_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static int send_all(int fd, const char* data, size_t len) {
+    while (len > 0) {
+        const ssize_t n = send(fd, data, len, 0);
+        if (n <= 0) return -1;
+        data += n;
+        len -= (size_t)n;
+    }
+    return 0;
+}
+
+static int send_response(int fd, int code, const char* reason,
+                         const char* body, size_t body_len, int head_only) {
+    char header[256];
+    const int n = snprintf(header, sizeof(header),
+                           "HTTP/1.1 %d %s\r\n"
+                           "Content-Type: text/html\r\n"
+                           "Content-Length: %zu\r\n"
+                           "\r\n",
+                           code, reason, body_len);
+    if (send_all(fd, header, (size_t)n) != 0) return -1;
+    if (head_only || body_len == 0) return 0;
+    return send_all(fd, body, body_len);
+}
+
+static const char* pick_submission_html(const char* body);
+
+/* Applies the cooldown, if enabled. Writes the page into buf. */
+static const char* submission_html(MockAocServer* s, const char* body, char* buf, size_t buf_size) {
+    pthread_mutex_lock(&s->lock);
+    const int cooldown = s->cooldown;
+    const double now = mono_now();
+    const double left = s->locked_until - now;
+    pthread_mutex_unlock(&s->lock);
+
+    if (cooldown <= 0) return pick_submission_html(body);
+
+    if (left > 0) {
+        const int secs = (int)left + ((double)(int)left < left ? 1 : 0);
+        snprintf(buf, buf_size, HTML_WAIT_COOLDOWN, secs);
+        return buf;
+    }
+
+    const char* html = pick_submission_html(body);
+    if (html == HTML_WRONG) {
+        pthread_mutex_lock(&s->lock);
+        s->locked_until = now + cooldown;
+        pthread_mutex_unlock(&s->lock);
+        snprintf(buf, buf_size, HTML_WRONG_COOLDOWN, cooldown);
+        return buf;
+    }
+    return html;
+}
+
+static const char* pick_submission_html(const char* body) {
+    const char* answer = body ? strstr(body, "answer=") : NULL;
+    if (!answer) return HTML_OTHER;
+    answer += strlen("answer=");
+    if (strncmp(answer, "right", 5) == 0) return HTML_RIGHT;
+    if (strncmp(answer, "wrong", 5) == 0) return HTML_WRONG;
+    if (strncmp(answer, "wait", 4) == 0) return HTML_WAIT;
+    if (strncmp(answer, "done", 4) == 0) return HTML_DONE;
+    return HTML_OTHER;
+}
+
+static int serve_input(MockAocServer* s, int fd, int year, int day) {
+    pthread_mutex_lock(&s->lock);
+    const size_t pad_to = s->input_size;
+    pthread_mutex_unlock(&s->lock);
+
+    char line[64];
+    const int line_len = snprintf(line, sizeof(line), "%d day %d\n", year, day);
+    const size_t len = pad_to > (size_t)line_len ? pad_to : (size_t)line_len;
+
+    char* body = malloc(len);
+    if (!body) return -1;
+    for (size_t i = 0; i < len; i += (size_t)line_len) {
+        const size_t chunk = len - i < (size_t)line_len ? len - i : (size_t)line_len;
+        memcpy(body + i, line, chunk);
+    }
+    // Always end in a newline so the client's trailing-newline strip is exercised.
+    body[len - 1] = '\n';
+
+    const int rc = send_response(fd, 200, "OK", body, len, 0);
+    free(body);
+    return rc;
+}
+
+/* Handles one complete request at the front of c->buf.
+ * Returns bytes consumed, 0 if incomplete, -1 to close the connection. */
+static ssize_t handle_request(MockAocServer* s, mock_conn* c) {
+    c->buf[c->len] = '\0';
+    char* header_end = strstr(c->buf, "\r\n\r\n");
+    if (!header_end) {
+        return c->len >= MOCK_MAX_REQUEST - 1 ? -1 : 0;
+    }
+
+    size_t content_length = 0;
+    const char* cl = strcasestr(c->buf, "\r\nContent-Length:");
+    if (cl && cl < header_end) {
+        content_length = (size_t)strtoul(cl + strlen("\r\nContent-Length:"), NULL, 10);
+    }
+    const size_t header_len = (size_t)(header_end - c->buf) + 4;
+    if (header_len + content_length > MOCK_MAX_REQUEST - 1) return -1;
+    if (c->len < header_len + content_length) return 0;
+
+    char method[8] = {0};
+    char path[256] = {0};
+    if (sscanf(c->buf, "%7s %255s", method, path) != 2) return -1;
+
+    // Body is only needed for POST; terminate it in place.
+    char saved = c->buf[header_len + content_length];
+    c->buf[header_len + content_length] = '\0';
+    const char* body = c->buf + header_len;
+
+    pthread_mutex_lock(&s->lock);
+    s->requests++;
+    pthread_mutex_unlock(&s->lock);
+
+    int year = 0, day = 0;
+    char tail[32] = {0};
+    const int fields = sscanf(path, "/%d/day/%d/%31s", &year, &day, tail);
+
+    int rc;
+    if (fields >= 2 && (day < 1 || day > 25)) {
+        static const char not_found[] = "404 Not Found\n";
+        rc = send_response(c->fd, 404, "Not Found", not_found, sizeof(not_found) - 1,
+                           strcmp(method, "HEAD") == 0);
+    } else if (strcmp(method, "GET") == 0 && fields == 3 && strcmp(tail, "input") == 0) {
+        rc = serve_input(s, c->fd, year, day);
+    } else if (strcmp(method, "HEAD") == 0 && fields == 2) {
+        rc = send_response(c->fd, 200, "OK", NULL, 0, 1);
+    } else if (strcmp(method, "POST") == 0 && fields == 3 && strcmp(tail, "answer") == 0) {
+        char page[1024];
+        const char* html = submission_html(s, body, page, sizeof(page));
+        rc = send_response(c->fd, 200, "OK", html, strlen(html), 0);
+    } else {
+        static const char not_found[] = "404 Not Found\n";
+        rc = send_response(c->fd, 404, "Not Found", not_found, sizeof(not_found) - 1,
+                           strcmp(method, "HEAD") == 0);
+    }
+
+    c->buf[header_len + content_length] = saved;
+    return rc == 0 ? (ssize_t)(header_len + content_length) : -1;
+}
+
+static void close_conn(MockAocServer* s, int slot) {
+    close(s->conns[slot]->fd);
+    free(s->conns[slot]);
+    s->conns[slot] = NULL;
+}
+
+static void accept_conn(MockAocServer* s) {
+    const int fd = accept(s->listen_fd, NULL, NULL);
+    if (fd < 0) return;
+    // Header and body go out in separate sends; don't let Nagle hold the body.
+    const int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+    for (int i = 0; i < MOCK_MAX_CONNS; i++) {
+        if (s->conns[i]) continue;
+        mock_conn* c = malloc(sizeof(mock_conn));
+        if (!c) break;
+        c->fd = fd;
+        c->len = 0;
+        s->conns[i] = c;
+
+        pthread_mutex_lock(&s->lock);
+        s->connections++;
+        pthread_mutex_unlock(&s->lock);
+        return;
+    }
+    close(fd);
+}
+
+static void read_conn(MockAocServer* s, int slot) {
+    mock_conn* c = s->conns[slot];
+    const ssize_t n = recv(c->fd, c->buf + c->len, MOCK_MAX_REQUEST - 1 - c->len, 0);
+    if (n <= 0) {
+        close_conn(s, slot);
+        return;
+    }
+    c->len += (size_t)n;
+
+    for (;;) {
+        const ssize_t used = handle_request(s, c);
+        if (used < 0) {
+            close_conn(s, slot);
+            return;
+        }
+        if (used == 0) return;
+        memmove(c->buf, c->buf + used, c->len - (size_t)used);
+        c->len -= (size_t)used;
+    }
+}
+
+static void* server_thread(void* arg) {
+    MockAocServer* s = arg;
+    struct pollfd fds[MOCK_MAX_CONNS + 2];
+    int slots[MOCK_MAX_CONNS + 2];
+
+    for (;;) {
+        nfds_t n = 0;
+        fds[n++] = (struct pollfd){ .fd = s->wake_pipe[0], .events = POLLIN };
+        fds[n++] = (struct pollfd){ .fd = s->listen_fd, .events = POLLIN };
+        for (int i = 0; i < MOCK_MAX_CONNS; i++) {
+            if (!s->conns[i]) continue;
+            slots[n] = i;
+            fds[n++] = (struct pollfd){ .fd = s->conns[i]->fd, .events = POLLIN };
+        }
+
+        if (poll(fds, n, -1) < 0) continue;
+        if (fds[0].revents) break;
+        if (fds[1].revents & POLLIN) accept_conn(s);
+        for (nfds_t i = 2; i < n; i++) {
+            if (fds[i].revents) read_conn(s, slots[i]);
+        }
+    }
+    return NULL;
+}
+
+MockAocServer* mock_aoc_server_start(void) {
+    // A client hanging up mid-response must not kill the test process.
+    signal(SIGPIPE, SIG_IGN);
+
+    MockAocServer* s = calloc(1, sizeof(MockAocServer));
+    if (!s) {
+        fprintf(stderr, "mock_aoc_server_start: out of memory\n");
+        abort();
+    }
+    pthread_mutex_init(&s->lock, NULL);
+
+    s->listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (s->listen_fd < 0 || pipe(s->wake_pipe) != 0) {
+        perror("mock_aoc_server_start");
+        free(s);
+        return NULL;
+    }
+
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = 0; // any free port
+
+    socklen_t addr_len = sizeof(addr);
+    if (bind(s->listen_fd, (struct sockaddr*)&addr, sizeof(addr)) != 0 ||
+        listen(s->listen_fd, 64) != 0 ||
+        getsockname(s->listen_fd, (struct sockaddr*)&addr, &addr_len) != 0) {
+        perror("mock_aoc_server_start");
+        close(s->listen_fd);
+        close(s->wake_pipe[0]);
+        close(s->wake_pipe[1]);
+        free(s);
+        return NULL;
+    }
+    snprintf(s->url, sizeof(s->url), "http://127.0.0.1:%d", ntohs(addr.sin_port));
+
+    if (pthread_create(&s->thread, NULL, server_thread, s) != 0) {
+        close(s->listen_fd);
+        close(s->wake_pipe[0]);
+        close(s->wake_pipe[1]);
+        free(s);
+        return NULL;
+    }
+    return s;
+}
+
+void mock_aoc_server_stop(MockAocServer* s) {
+    if (!s) return;
+    const char wake = 1;
+    if (write(s->wake_pipe[1], &wake, 1) != 1) {
+        perror("mock_aoc_server_stop");
+    }
+    pthread_join(s->thread, NULL);
+
+    for (int i = 0; i < MOCK_MAX_CONNS; i++) {
+        if (s->conns[i]) close_conn(s, i);
+    }
+    close(s->listen_fd);
+    close(s->wake_pipe[0]);
+    close(s->wake_pipe[1]);
+    pthread_mutex_destroy(&s->lock);
+    free(s);
+}
+
+const char* mock_aoc_server_url(MockAocServer* s) {
+    return s ? s->url : NULL;
+}
+
+void mock_aoc_server_set_input_size(MockAocServer* s, size_t bytes) {
+    if (!s) return;
+    pthread_mutex_lock(&s->lock);
+    s->input_size = bytes;
+    pthread_mutex_unlock(&s->lock);
+}
+
+void mock_aoc_server_set_cooldown(MockAocServer* s, int seconds) {
+    if (!s) return;
+    pthread_mutex_lock(&s->lock);
+    s->cooldown = seconds;
+    s->locked_until = 0;
+    pthread_mutex_unlock(&s->lock);
+}
+
+size_t mock_aoc_server_connections(MockAocServer* s) {
+    if (!s) return 0;
+    pthread_mutex_lock(&s->lock);
+    const size_t n = s->connections;
+    pthread_mutex_unlock(&s->lock);
+    return n;
+}
+
+size_t mock_aoc_server_requests(MockAocServer* s) {
+    if (!s) return 0;
+    pthread_mutex_lock(&s->lock);
+    const size_t n = s->requests;
+    pthread_mutex_unlock(&s->lock);
+    return n;
+}
@@ -0,0 +1,37 @@
+// mock_aoc_server.h
+#ifndef MOCK_AOC_SERVER_H
+#define MOCK_AOC_SERVER_H
+
+#include <stddef.h>
+
+/**
+ * Minimal HTTP/1.1 stand-in for adventofcode.com, served from a background
+ * thread on 127.0.0.1. Connections are kept alive like the real site.
+ *
+ *   GET  /YEAR/day/D/input   -> "YEAR day D\n" padded to the input size
+ *   HEAD /YEAR/day/D         -> 200, empty
+ *   POST /YEAR/day/D/answer  -> canned article HTML picked by the answer:
+ *                               "right", "wrong", "wait", "done",
+ *                               anything else yields an unrecognised page
+ *
+ * With a cooldown set, a wrong answer locks submissions for that many
+ * seconds; submissions during the lock get "You have Ns left to wait".
+ */
+typedef struct MockAocServer MockAocServer;
+
+MockAocServer* mock_aoc_server_start(void);
+void mock_aoc_server_stop(MockAocServer* s);
+
+/* Base URL to put into AOC_BASE_URL, e.g. "http://127.0.0.1:51234". */
+const char* mock_aoc_server_url(MockAocServer* s);
+
+/* Pad every input body to at least this many bytes (default: no padding). */
+void mock_aoc_server_set_input_size(MockAocServer* s, size_t bytes);
+
+/* Rate-limit wrong answers like the real site (0 disables, the default). */
+void mock_aoc_server_set_cooldown(MockAocServer* s, int seconds);
+
+size_t mock_aoc_server_connections(MockAocServer* s);
+size_t mock_aoc_server_requests(MockAocServer* s);
+
+#endif
@@ -0,0 +1,28 @@
+#include "tests/mock_aoc_server.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Runs the stand-in server until stdin is closed (Ctrl-D), e.g.
+ *
+ *   ./bin/mock_aoc_server
+ *   AOC_BASE_URL=http://127.0.0.1:PORT AOC_SESSION=x ./bin/2025_day01 --submit
+ */
+int main(void) {
+    MockAocServer* s = mock_aoc_server_start();
+    if (!s) {
+        fprintf(stderr, "Failed to start mock server.\n");
+        return 1;
+    }
+
+    printf("AOC_BASE_URL=%s\n", mock_aoc_server_url(s));
+    fflush(stdout);
+
+    while (getchar() != EOF) {
+    }
+
+    printf("Served %zu request(s) on %zu connection(s).\n",
+           mock_aoc_server_requests(s), mock_aoc_server_connections(s));
+    mock_aoc_server_stop(s);
+    return 0;
+}
@@ -0,0 +1,204 @@
+#include <assert.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "thread_pool.h"
+
+// ---- parallel_for -------------------------------------------------------------
+
+static void mark_range(size_t begin, size_t end, void* ctx) {
+    unsigned char* hits = ctx;
+    for (size_t i = begin; i < end; i++) hits[i]++;
+}
+
+static void test_parallel_for(void) {
+    const size_t n = 100000;
+    unsigned char* hits = calloc(n, 1);
+    assert(hits != NULL);
+
+    parallel_for(0, n, 0, mark_range, hits);
+    for (size_t i = 0; i < n; i++) assert(hits[i] == 1);
+
+    // Odd bounds and a grain that doesn't divide the range.
+    memset(hits, 0, n);
+    parallel_for(17, 9001, 7, mark_range, hits);
+    for (size_t i = 0; i < n; i++) assert(hits[i] == (i >= 17 && i < 9001));
+
+    parallel_for(5, 5, 0, mark_range, hits); // empty: no call
+    free(hits);
+}
+
+// ---- parallel_reduce ----------------------------------------------------------
+
+static void sum_init(void* acc, void* ctx) {
+    (void)ctx;
+    *(uint64_t*)acc = 0;
+}
+
+static void sum_body(size_t begin, size_t end, void* acc, void* ctx) {
+    const uint64_t* values = ctx;
+    for (size_t i = begin; i < end; i++) *(uint64_t*)acc += values[i];
+}
+
+static void sum_combine(void* acc, const void* other, void* ctx) {
+    (void)ctx;
+    *(uint64_t*)acc += *(const uint64_t*)other;
+}
+
+/* Not commutative: a hash of the chunk order. */
+typedef struct {
+    uint64_t hash;
+    size_t last;
+} order_acc;
+
+static void order_init(void* acc, void* ctx) {
+    (void)ctx;
+    order_acc* a = acc;
+    a->hash = 1469598103934665603ull;
+    a->last = 0;
+}
+
+static void order_body(size_t begin, size_t end, void* acc, void* ctx) {
+    (void)ctx;
+    order_acc* a = acc;
+    for (size_t i = begin; i < end; i++) {
+        a->hash = (a->hash ^ i) * 1099511628211ull;
+    }
+    a->last = end;
+}
+
+static void order_combine(void* acc, const void* other, void* ctx) {
+    size_t* chunks = ctx;
+    order_acc* a = acc;
+    const order_acc* b = other;
+    a->hash = (a->hash ^ b->hash) * 1099511628211ull;
+    assert(b->last > a->last);
+    a->last = b->last;
+    (*chunks)++;
+}
+
+static void test_parallel_reduce(void) {
+    const size_t n = 50000;
+    uint64_t* values = malloc(n * sizeof(uint64_t));
+    assert(values != NULL);
+    for (size_t i = 0; i < n; i++) values[i] = i * 3 + 1;
+
+    uint64_t sum = 0;
+    parallel_reduce(0, n, 0, &sum, sizeof(sum), sum_init, sum_body, sum_combine, values);
+    assert(sum == 3 * (uint64_t)n * (n - 1) / 2 + n);
+
+    // Same chunks, combined in the same order, every time.
+    order_acc first;
+    size_t chunks = 0;
+    parallel_reduce(0, n, 100, &first, sizeof(first), order_init, order_body, order_combine, &chunks);
+    assert(chunks == n / 100);
+    for (int run = 0; run < 20; run++) {
+        order_acc again;
+        chunks = 0;
+        parallel_reduce(0, n, 100, &again, sizeof(again), order_init, order_body, order_combine, &chunks);
+        assert(again.hash == first.hash);
+        assert(again.last == n);
+    }
+
+    sum = 99;
+    parallel_reduce(3, 3, 0, &sum, sizeof(sum), sum_init, sum_body, sum_combine, values);
+    assert(sum == 0);
+    free(values);
+}
+
+// ---- task groups --------------------------------------------------------------
+
+typedef struct {
+    int depth;
+    atomic_int* leaves;
+} tree_task;
+
+/* Each node spawns two children into its own group and waits on them. */
+static void tree_node(void* arg) {
+    const tree_task* t = arg;
+    if (t->depth == 0) {
+        atomic_fetch_add(t->leaves, 1);
+        return;
+    }
+    task_group g;
+    task_group_init(&g);
+    tree_task* kids = thread_arena_alloc(2 * sizeof(tree_task));
+    for (int i = 0; i < 2; i++) {
+        kids[i].depth = t->depth - 1;
+        kids[i].leaves = t->leaves;
+        task_group_spawn(&g, tree_node, &kids[i]);
+    }
+    task_group_wait(&g);
+}
+
+static void add_one(void* arg) {
+    atomic_fetch_add((atomic_int*)arg, 1);
+}
+
+static void test_task_groups(void) {
+    atomic_int leaves;
+    atomic_init(&leaves, 0);
+    tree_task root = { 12, &leaves };
+    task_group g;
+    task_group_init(&g);
+    task_group_spawn(&g, tree_node, &root);
+    task_group_wait(&g);
+    assert(atomic_load(&leaves) == 1 << 12);
+
+    // More tasks than a deque holds: the overflow runs inline.
+    atomic_int count;
+    atomic_init(&count, 0);
+    task_group_init(&g);
+    for (int i = 0; i < 10000; i++) task_group_spawn(&g, add_one, &count);
+    task_group_wait(&g);
+    assert(atomic_load(&count) == 10000);
+}
+
+// ---- arenas -------------------------------------------------------------------
+
+static void arena_range(size_t begin, size_t end, void* ctx) {
+    (void)ctx;
+    for (size_t i = begin; i < end; i++) {
+        const size_t size = 1 + (i * 37) % 5000;
+        unsigned char* p = thread_arena_alloc(size);
+        assert(((uintptr_t)p & 15) == 0);
+        memset(p, (int)(i & 0xff), size);
+        for (size_t k = 0; k < size; k += 97) assert(p[k] == (unsigned char)(i & 0xff));
+    }
+}
+
+static void test_arena(void) {
+    parallel_for(0, 2000, 8, arena_range, NULL);
+    // A block bigger than a chunk still works.
+    unsigned char* big = thread_arena_alloc(1 << 20);
+    memset(big, 1, 1 << 20);
+}
+
+static void run_all(void) {
+    test_parallel_for();
+    test_parallel_reduce();
+    test_task_groups();
+    test_arena();
+}
+
+int main(void) {
+    printf("Running thread pool tests...\n");
+
+    // More threads than this machine may have, to force stealing.
+    thread_pool_set_threads(4);
+    assert(thread_pool_threads() == 4);
+    run_all();
+    thread_pool_shutdown();
+
+    // Single thread: everything inline.
+    thread_pool_set_threads(1);
+    assert(thread_pool_threads() == 1);
+    run_all();
+    thread_pool_shutdown();
+
+    printf("All thread pool tests passed.\n");
+    return 0;
+}
@@ -0,0 +1,511 @@
+#include "thread_pool.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define TP_CACHE_LINE 64
+#define TP_DEQUE_CAP 4096 // per thread; a spawn into a full deque runs inline
+#define TP_ARENA_CHUNK (64 * 1024)
+#define TP_SPIN_PAUSES 64
+#define TP_SPIN_YIELDS 16
+#define TP_PIECES_PER_THREAD 8
+
+typedef struct {
+    void (*fn)(void*);
+    void* arg;
+    task_group* group;
+} tp_task;
+
+typedef struct tp_arena_chunk {
+    struct tp_arena_chunk* next;
+    size_t used;
+    size_t cap;
+    _Alignas(16) unsigned char data[];
+} tp_arena_chunk;
+
+/* Chase-Lev work-stealing deque (the C11 formulation by Lê et al.). The
+ * owner pushes and pops at bottom; thieves take from top. */
+typedef struct {
+    _Alignas(TP_CACHE_LINE) _Atomic int64_t top;
+    _Alignas(TP_CACHE_LINE) _Atomic int64_t bottom;
+    _Alignas(TP_CACHE_LINE) tp_task* _Atomic buf[TP_DEQUE_CAP];
+} tp_deque;
+
+typedef struct tp_pool tp_pool;
+
+typedef struct {
+    tp_deque deque;
+    // Owner-only from here on, apart from the counters' relaxed reads.
+    _Alignas(TP_CACHE_LINE) tp_arena_chunk* arena; // newest chunk first
+    atomic_size_t spawned;
+    atomic_size_t completed;
+    tp_pool* pool;
+    pthread_t thread;
+    int index;
+    uint32_t rng;
+} tp_worker;
+
+struct tp_pool {
+    tp_worker* workers; // [0] is the external caller, [1..n) pool threads
+    int n;
+    int depth;          // parallel calls in progress on the external thread
+    atomic_bool shutdown;
+    atomic_int sleeping;
+    unsigned epoch;     // guarded by lock; bumped to wake sleepers
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+};
+
+static tp_pool* g_pool;
+static int g_requested_threads;
+static _Thread_local tp_worker* tls_worker;
+
+static void* tp_alloc(size_t size) {
+    void* p = malloc(size);
+    if (!p) {
+        fprintf(stderr, "thread_pool: out of memory\n");
+        abort();
+    }
+    return p;
+}
+
+static inline void cpu_relax(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+// ---- deque -------------------------------------------------------------------
+
+static bool deque_push(tp_deque* d, tp_task* t) {
+    const int64_t b = atomic_load_explicit(&d->bottom, memory_order_relaxed);
+    const int64_t top = atomic_load_explicit(&d->top, memory_order_acquire);
+    if (b - top >= TP_DEQUE_CAP) return false;
+    atomic_store_explicit(&d->buf[b & (TP_DEQUE_CAP - 1)], t, memory_order_relaxed);
+    atomic_store_explicit(&d->bottom, b + 1, memory_order_release); // publishes *t
+    return true;
+}
+
+static tp_task* deque_pop(tp_deque* d) {
+    const int64_t b = atomic_load_explicit(&d->bottom, memory_order_relaxed) - 1;
+    atomic_store_explicit(&d->bottom, b, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    int64_t top = atomic_load_explicit(&d->top, memory_order_relaxed);
+    if (top > b) {
+        atomic_store_explicit(&d->bottom, b + 1, memory_order_relaxed);
+        return NULL;
+    }
+    tp_task* t = atomic_load_explicit(&d->buf[b & (TP_DEQUE_CAP - 1)], memory_order_relaxed);
+    if (top == b) {
+        // Last element: race thieves for it.
+        if (!atomic_compare_exchange_strong_explicit(&d->top, &top, top + 1,
+                                                     memory_order_seq_cst, memory_order_relaxed)) {
+            t = NULL;
+        }
+        atomic_store_explicit(&d->bottom, b + 1, memory_order_relaxed);
+    }
+    return t;
+}
+
+static tp_task* deque_steal(tp_deque* d) {
+    int64_t top = atomic_load_explicit(&d->top, memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    const int64_t b = atomic_load_explicit(&d->bottom, memory_order_acquire);
+    if (top >= b) return NULL;
+    tp_task* t = atomic_load_explicit(&d->buf[top & (TP_DEQUE_CAP - 1)], memory_order_relaxed);
+    if (!atomic_compare_exchange_strong_explicit(&d->top, &top, top + 1,
+                                                 memory_order_seq_cst, memory_order_relaxed)) {
+        return NULL; // lost the race; the caller moves on
+    }
+    return t;
+}
+
+// ---- arenas ------------------------------------------------------------------
+
+static void* arena_alloc(tp_worker* w, size_t size) {
+    size = (size + 15) & ~(size_t)15;
+    tp_arena_chunk* c = w->arena;
+    if (!c || c->cap - c->used < size) {
+        const size_t cap = size > TP_ARENA_CHUNK ? size : TP_ARENA_CHUNK;
+        tp_arena_chunk* fresh = tp_alloc(sizeof(tp_arena_chunk) + cap);
+        fresh->used = 0;
+        fresh->cap = cap;
+        fresh->next = c;
+        w->arena = c = fresh;
+    }
+    void* p = c->data + c->used;
+    c->used += size;
+    return p;
+}
+
+/* Keep the newest chunk for reuse, free the rest. */
+static void arena_reset(tp_worker* w) {
+    tp_arena_chunk* c = w->arena;
+    if (!c) return;
+    tp_arena_chunk* rest = c->next;
+    while (rest) {
+        tp_arena_chunk* next = rest->next;
+        free(rest);
+        rest = next;
+    }
+    c->next = NULL;
+    c->used = 0;
+}
+
+static void arena_free(tp_worker* w) {
+    tp_arena_chunk* c = w->arena;
+    while (c) {
+        tp_arena_chunk* next = c->next;
+        free(c);
+        c = next;
+    }
+    w->arena = NULL;
+}
+
+// ---- scheduling --------------------------------------------------------------
+
+static void run_task(tp_worker* w, tp_task* t) {
+    // Once completed is bumped the arenas may be recycled under t.
+    task_group* g = t->group;
+    t->fn(t->arg);
+    atomic_fetch_add_explicit(&w->completed, 1, memory_order_release);
+    atomic_fetch_sub_explicit(&g->pending, 1, memory_order_release);
+}
+
+static tp_task* find_work(tp_pool* p, tp_worker* w) {
+    tp_task* t = deque_pop(&w->deque);
+    if (t || p->n == 1) return t;
+
+    // xorshift: pick a random first victim so thieves spread out.
+    w->rng ^= w->rng << 13;
+    w->rng ^= w->rng >> 17;
+    w->rng ^= w->rng << 5;
+    const int start = (int)(w->rng % (uint32_t)p->n);
+    for (int k = 0; k < p->n; k++) {
+        const int v = (start + k) % p->n;
+        if (v == w->index) continue;
+        t = deque_steal(&p->workers[v].deque);
+        if (t) return t;
+    }
+    return NULL;
+}
+
+static void notify(tp_pool* p) {
+    // Pairs with the sleeping increment in idle_wait: either we see the
+    // sleeper, or its re-scan under the lock sees our task.
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(&p->sleeping, memory_order_relaxed) > 0) {
+        pthread_mutex_lock(&p->lock);
+        p->epoch++;
+        pthread_cond_signal(&p->wake);
+        pthread_mutex_unlock(&p->lock);
+    }
+}
+
+static tp_task* idle_wait(tp_pool* p, tp_worker* w) {
+    pthread_mutex_lock(&p->lock);
+    atomic_fetch_add(&p->sleeping, 1);
+    const unsigned epoch = p->epoch;
+    tp_task* t = find_work(p, w);
+    while (!t && p->epoch == epoch && !atomic_load(&p->shutdown)) {
+        pthread_cond_wait(&p->wake, &p->lock);
+    }
+    atomic_fetch_sub(&p->sleeping, 1);
+    pthread_mutex_unlock(&p->lock);
+    return t;
+}
+
+static void* worker_main(void* arg) {
+    tp_worker* w = arg;
+    tp_pool* p = w->pool;
+    tls_worker = w;
+
+    unsigned spins = 0;
+    while (!atomic_load_explicit(&p->shutdown, memory_order_acquire)) {
+        tp_task* t = find_work(p, w);
+        if (!t) {
+            if (spins < TP_SPIN_PAUSES) {
+                cpu_relax();
+                spins++;
+                continue;
+            }
+            if (spins < TP_SPIN_PAUSES + TP_SPIN_YIELDS) {
+                sched_yield();
+                spins++;
+                continue;
+            }
+            t = idle_wait(p, w);
+            spins = 0;
+            if (!t) continue;
+        }
+        run_task(w, t);
+        spins = 0;
+    }
+    return NULL;
+}
+
+static int default_threads(void) {
+    const long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    return cpus > 0 ? (int)cpus : 1;
+}
+
+static tp_pool* pool_get(void) {
+    if (g_pool) return g_pool;
+
+    tp_pool* p = tp_alloc(sizeof(tp_pool));
+    p->n = g_requested_threads > 0 ? g_requested_threads : default_threads();
+    p->depth = 0;
+    p->epoch = 0;
+    atomic_init(&p->shutdown, false);
+    atomic_init(&p->sleeping, 0);
+    pthread_mutex_init(&p->lock, NULL);
+    pthread_cond_init(&p->wake, NULL);
+
+    p->workers = aligned_alloc(TP_CACHE_LINE, (size_t)p->n * sizeof(tp_worker));
+    if (!p->workers) {
+        fprintf(stderr, "thread_pool: out of memory\n");
+        abort();
+    }
+    for (int i = 0; i < p->n; i++) {
+        tp_worker* w = &p->workers[i];
+        memset(w, 0, sizeof(*w));
+        atomic_init(&w->deque.top, 0);
+        atomic_init(&w->deque.bottom, 0);
+        atomic_init(&w->spawned, 0);
+        atomic_init(&w->completed, 0);
+        w->pool = p;
+        w->index = i;
+        w->rng = 0x9e3779b9u * (uint32_t)(i + 1);
+    }
+    g_pool = p;
+
+    for (int i = 1; i < p->n; i++) {
+        if (pthread_create(&p->workers[i].thread, NULL, worker_main, &p->workers[i]) != 0) {
+            fprintf(stderr, "thread_pool: could not start worker %d\n", i);
+            abort();
+        }
+    }
+    return p;
+}
+
+static tp_worker* current_worker(tp_pool* p) {
+    return tls_worker ? tls_worker : &p->workers[0];
+}
+
+static void enter(tp_pool* p) {
+    if (!tls_worker) p->depth++;
+}
+
+/* Leaving the outermost call: if no task is left anywhere, every arena
+ * can be recycled. */
+static void leave(tp_pool* p) {
+    if (tls_worker || --p->depth > 0) return;
+    size_t completed = 0, spawned = 0;
+    for (int i = 0; i < p->n; i++) {
+        completed += atomic_load_explicit(&p->workers[i].completed, memory_order_acquire);
+    }
+    for (int i = 0; i < p->n; i++) {
+        spawned += atomic_load_explicit(&p->workers[i].spawned, memory_order_acquire);
+    }
+    if (completed != spawned) return;
+    for (int i = 0; i < p->n; i++) {
+        arena_reset(&p->workers[i]);
+    }
+}
+
+void thread_pool_set_threads(int n) {
+    g_requested_threads = n > 0 ? n : 0;
+}
+
+int thread_pool_threads(void) {
+    return pool_get()->n;
+}
+
+void thread_pool_shutdown(void) {
+    tp_pool* p = g_pool;
+    if (!p) return;
+
+    pthread_mutex_lock(&p->lock);
+    atomic_store(&p->shutdown, true);
+    p->epoch++;
+    pthread_cond_broadcast(&p->wake);
+    pthread_mutex_unlock(&p->lock);
+    for (int i = 1; i < p->n; i++) {
+        pthread_join(p->workers[i].thread, NULL);
+    }
+
+    for (int i = 0; i < p->n; i++) {
+        arena_free(&p->workers[i]);
+    }
+    pthread_mutex_destroy(&p->lock);
+    pthread_cond_destroy(&p->wake);
+    free(p->workers);
+    free(p);
+    g_pool = NULL;
+}
+
+void* thread_arena_alloc(size_t size) {
+    tp_pool* p = pool_get();
+    return arena_alloc(current_worker(p), size);
+}
+
+// ---- task groups -------------------------------------------------------------
+
+void task_group_init(task_group* g) {
+    atomic_init(&g->pending, 0);
+}
+
+void task_group_spawn(task_group* g, void (*fn)(void* arg), void* arg) {
+    tp_pool* p = pool_get();
+    tp_worker* w = current_worker(p);
+
+    atomic_fetch_add_explicit(&g->pending, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&w->spawned, 1, memory_order_relaxed);
+
+    tp_task* t = arena_alloc(w, sizeof(tp_task));
+    t->fn = fn;
+    t->arg = arg;
+    t->group = g;
+    if (p->n == 1 || !deque_push(&w->deque, t)) {
+        run_task(w, t);
+        return;
+    }
+    notify(p);
+}
+
+void task_group_wait(task_group* g) {
+    tp_pool* p = pool_get();
+    tp_worker* w = current_worker(p);
+    enter(p);
+
+    unsigned spins = 0;
+    while (atomic_load_explicit(&g->pending, memory_order_acquire) > 0) {
+        tp_task* t = find_work(p, w);
+        if (t) {
+            run_task(w, t);
+            spins = 0;
+        } else if (++spins < TP_SPIN_PAUSES) {
+            cpu_relax();
+        } else {
+            sched_yield();
+        }
+    }
+
+    leave(p);
+}
+
+// ---- loops -------------------------------------------------------------------
+
+typedef struct {
+    size_t begin;
+    size_t end;
+    size_t grain;
+    parallel_for_fn fn;
+    void* ctx;
+    task_group* group;
+} tp_range;
+
+/* Hand off right halves until the piece is grain-sized, then run it. */
+static void range_task(void* arg) {
+    const tp_range* r = arg;
+    size_t b = r->begin;
+    size_t e = r->end;
+    while (e - b > r->grain) {
+        const size_t mid = b + (e - b) / 2;
+        tp_range* right = thread_arena_alloc(sizeof(tp_range));
+        *right = *r;
+        right->begin = mid;
+        right->end = e;
+        task_group_spawn(r->group, range_task, right);
+        e = mid;
+    }
+    r->fn(b, e, r->ctx);
+}
+
+static size_t auto_grain(size_t n, int threads) {
+    const size_t pieces = (size_t)threads * TP_PIECES_PER_THREAD;
+    const size_t grain = (n + pieces - 1) / pieces;
+    return grain > 0 ? grain : 1;
+}
+
+void parallel_for(size_t begin, size_t end, size_t grain, parallel_for_fn fn, void* ctx) {
+    if (begin >= end) return;
+    tp_pool* p = pool_get();
+    if (grain == 0) grain = auto_grain(end - begin, p->n);
+    if (p->n == 1 || end - begin <= grain) {
+        fn(begin, end, ctx);
+        return;
+    }
+
+    enter(p);
+    task_group g;
+    task_group_init(&g);
+    const tp_range root = { begin, end, grain, fn, ctx, &g };
+    range_task((void*)&root);
+    task_group_wait(&g);
+    leave(p);
+}
+
+typedef struct {
+    size_t begin;
+    size_t end;
+    size_t grain;
+    unsigned char* accs;
+    size_t stride;
+    void (*init)(void*, void*);
+    void (*body)(size_t, size_t, void*, void*);
+    void* ctx;
+} tp_reduce;
+
+static void reduce_chunks(size_t first, size_t last, void* arg) {
+    const tp_reduce* r = arg;
+    for (size_t c = first; c < last; c++) {
+        void* acc = r->accs + c * r->stride;
+        const size_t b = r->begin + c * r->grain;
+        const size_t e = r->end - b > r->grain ? b + r->grain : r->end;
+        r->init(acc, r->ctx);
+        r->body(b, e, acc, r->ctx);
+    }
+}
+
+void parallel_reduce(size_t begin, size_t end, size_t grain,
+                     void* result, size_t acc_size,
+                     void (*init)(void* acc, void* ctx),
+                     void (*body)(size_t begin, size_t end, void* acc, void* ctx),
+                     void (*combine)(void* acc, const void* other, void* ctx),
+                     void* ctx) {
+    init(result, ctx);
+    if (begin >= end) return;
+
+    tp_pool* p = pool_get();
+    if (grain == 0) grain = auto_grain(end - begin, p->n);
+    const size_t chunks = (end - begin + grain - 1) / grain;
+    if (chunks == 1) {
+        body(begin, end, result, ctx);
+        return;
+    }
+
+    // One accumulator per chunk, each on its own cache lines.
+    const size_t stride = (acc_size + TP_CACHE_LINE - 1) / TP_CACHE_LINE * TP_CACHE_LINE;
+    unsigned char* accs = aligned_alloc(TP_CACHE_LINE, chunks * stride);
+    if (!accs) {
+        fprintf(stderr, "parallel_reduce: out of memory\n");
+        abort();
+    }
+
+    tp_reduce r = { begin, end, grain, accs, stride, init, body, ctx };
+    parallel_for(0, chunks, 1, reduce_chunks, &r);
+
+    for (size_t c = 0; c < chunks; c++) {
+        combine(result, accs + c * stride, ctx);
+    }
+    free(accs);
+}
@@ -0,0 +1,79 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <stdatomic.h>
+#include <stddef.h>
+
+/**
+ * Process-wide work-stealing thread pool.
+ *
+ * The pool starts on first use with thread_pool_set_threads() workers
+ * (the runner's --threads), or one per online CPU. The thread that calls
+ * parallel_for & co. works too, so --threads 1 runs everything inline on
+ * the caller with no synchronisation at all.
+ *
+ * Each worker owns a Chase-Lev deque: it pushes and pops new tasks at
+ * the bottom (LIFO, cache-warm) while idle workers steal from the top
+ * (FIFO, the largest pieces). Waiting never blocks a thread that has
+ * something it could run: task_group_wait() executes queued tasks until
+ * its own group is done, so nested parallel loops are fine.
+ *
+ * Only one thread outside the pool (normally main) may start parallel
+ * work at a time.
+ */
+
+/* Total threads including the caller; 0 = one per CPU. Before first use. */
+void thread_pool_set_threads(int n);
+int thread_pool_threads(void);
+
+/* Join the workers. Later parallel calls restart the pool. */
+void thread_pool_shutdown(void);
+
+/**
+ * Scratch memory from the calling thread's arena, 16-byte aligned. For
+ * use inside tasks: it stays valid until the outermost parallel call
+ * (parallel_for, parallel_reduce or task_group_wait from the external
+ * thread) returns, then every arena is reset at once. Never NULL.
+ */
+void* thread_arena_alloc(size_t size);
+
+// ---- task groups -------------------------------------------------------------
+
+typedef struct {
+    atomic_size_t pending;
+} task_group;
+
+void task_group_init(task_group* g);
+
+/* Queue fn(arg) to run on any thread. arg must outlive the task. */
+void task_group_spawn(task_group* g, void (*fn)(void* arg), void* arg);
+
+/* Run queued tasks until every task spawned into g has finished. */
+void task_group_wait(task_group* g);
+
+// ---- loops -------------------------------------------------------------------
+
+typedef void (*parallel_for_fn)(size_t begin, size_t end, void* ctx);
+
+/**
+ * Call fn over disjoint subranges covering [begin, end), in parallel.
+ * The range is split in halves until pieces are at most grain long
+ * (0 picks a grain giving about eight pieces per thread).
+ */
+void parallel_for(size_t begin, size_t end, size_t grain, parallel_for_fn fn, void* ctx);
+
+/**
+ * Parallel reduction over [begin, end) in grain-sized chunks (0 = auto).
+ * Each chunk gets its own accumulator of acc_size bytes, set up by init
+ * and filled by body. result is init'ed, then the chunk accumulators are
+ * combined into it in index order, so the answer doesn't depend on
+ * scheduling even for non-commutative combines.
+ */
+void parallel_reduce(size_t begin, size_t end, size_t grain,
+                     void* result, size_t acc_size,
+                     void (*init)(void* acc, void* ctx),
+                     void (*body)(size_t begin, size_t end, void* acc, void* ctx),
+                     void (*combine)(void* acc, const void* other, void* ctx),
+                     void* ctx);
+
+#endif // THREAD_POOL_H
@@ -4,10 +4,13 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdarg.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <errno.h>
+#include <fcntl.h>
 #include <float.h>
+#include <unistd.h>
 
 char *str_dup(const char *s) {
     if (!s) return NULL;
@@ -39,24 +42,30 @@ char *path_join(const char *a, const char *b) {
 char *format_string(const char *fmt, ...) {
     va_list args;
     va_start(args, fmt);
-    va_list args_copy;
-    va_copy(args_copy, args);
+    va_list retry;
+    va_copy(retry, args);
 
-    int len = vsnprintf(NULL, 0, fmt, args_copy);
-    va_end(args_copy);
+    // Answers and paths fit on the stack, so one vsnprintf does; only
+    // longer results are formatted a second time, into the exact size.
+    char small[128];
+    const int len = vsnprintf(small, sizeof(small), fmt, args);
+    va_end(args);
     if (len < 0) {
-        va_end(args);
+        va_end(retry);
         return NULL;
     }
 
     char *buf = malloc((size_t)len + 1);
     if (!buf) {
-        va_end(args);
+        va_end(retry);
         return NULL;
     }
-
-    vsnprintf(buf, (size_t)len + 1, fmt, args);
-    va_end(args);
+    if ((size_t)len < sizeof(small)) {
+        memcpy(buf, small, (size_t)len + 1);
+    } else {
+        vsnprintf(buf, (size_t)len + 1, fmt, retry);
+    }
+    va_end(retry);
     return buf;
 }
 
@@ -110,6 +119,67 @@ int write_string_to_file(const char *path, const char *content) {
     return (written == len) ? 0 : -1;
 }
 
+int file_view_open(const char *path, file_view *out) {
+    memset(out, 0, sizeof(*out));
+    const int fd = open(path, O_RDONLY);
+    if (fd < 0) return -1;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < 0) {
+        close(fd);
+        return -1;
+    }
+    const size_t len = (size_t)st.st_size;
+
+    // The tail of the last mapped page reads as zeros, which gives us the
+    // terminating NUL for free -- unless the file ends exactly on a page.
+    const long page = sysconf(_SC_PAGESIZE);
+    if (len > 0 && page > 0 && len % (size_t)page != 0) {
+        void *p = mmap(NULL, len, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p != MAP_FAILED) {
+            close(fd);
+            out->data = p;
+            out->len = len;
+            out->map_len = len;
+            return 0;
+        }
+    }
+
+    char *buf = malloc(len + 1);
+    if (!buf) {
+        close(fd);
+        return -1;
+    }
+    size_t got = 0;
+    while (got < len) {
+        const ssize_t n = read(fd, buf + got, len - got);
+        if (n <= 0) {
+            if (n < 0 && errno == EINTR) continue;
+            break;
+        }
+        got += (size_t)n;
+    }
+    close(fd);
+    if (got != len) {
+        free(buf);
+        return -1;
+    }
+    buf[len] = '\0';
+    out->data = buf;
+    out->len = len;
+    return 0;
+}
+
+void file_view_close(file_view *v) {
+    if (!v || !v->data) return;
+    if (v->map_len > 0) {
+        munmap((void *)v->data, v->map_len);
+    } else {
+        free((void *)v->data);
+    }
+    memset(v, 0, sizeof(*v));
+}
+
 void strip_trailing_newlines(char *s) {
     if (!s) return;
     size_t len = strlen(s);
@@ -11,6 +11,17 @@ int ensure_dir_exists(const char *path);
 int read_file_to_string(const char *path, char **out_content);
 int write_string_to_file(const char *path, const char *content);
 
+/* Read-only view of a whole file. data is NUL-terminated and, when the
+ * size allows it, an mmap of the file rather than a copy. */
+typedef struct {
+    const char *data;
+    size_t len;
+    size_t map_len; // 0 if data was malloc'd instead of mapped
+} file_view;
+
+int file_view_open(const char *path, file_view *out);
+void file_view_close(file_view *v);
+
 void strip_trailing_newlines(char *s);
 void strip_html_tags_inplace(char *s);
 void normalize_whitespace_inplace(char *s);